@@ -0,0 +1,553 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef BENCHMARKS_HPP
+
+#include "benchmarks.hpp"
+
+using namespace std;
+
+using chrono::high_resolution_clock;
+using chrono::duration;
+
+static vector<double> generate_benchmark_signal(int signal_length, double sample_rate) {
+    /* Generates a deterministic multi-tone signal to filter during benchmarks */
+
+    vector<double> signal(signal_length);
+    for (int i = 0; i < signal_length; ++i) {
+        double t = i / sample_rate;
+        signal[i] = sin(2.0 * M_PI * 50.0 * t) + 0.5 * sin(2.0 * M_PI * 3000.0 * t) + 0.1 * sin(2.0 * M_PI * 9000.0 * t);
+    }
+    return signal;
+}
+
+static double legacy_apply_filter(
+    const vector<double>& coefficients, vector<double>& input_history, double sample
+) {
+    /* Original FIR implementation (shifts the whole history vector every sample), kept as a baseline */
+
+    input_history.push_back(sample);
+    input_history.erase(input_history.begin());
+
+    double result = 0.0;
+    int final_index = (int) input_history.size() - 1;
+    for (int i = 0; i < coefficients.size(); ++i) {
+        result += coefficients[i] * input_history[final_index - i];
+    }
+    return result;
+}
+
+static void benchmark_fir_history(const vector<double>& signal, double sample_rate, int num_taps) {
+    /* Compares the per-sample cost of the shifting history against the ring buffer delay line
+     *
+     * param signal: Signal to filter
+     * param sample_rate: Sample rate of the signal
+     * param num_taps: Number of filter coefficients = (2 * num_taps) + 1
+     */
+
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        low_pass, sample_rate, {sample_rate / 10.0}, num_taps
+    );
+    vector<double> coefficients = filter.get_coefficients();
+    vector<double> legacy_history(coefficients.size(), 0.0);
+
+    vector<double> legacy_output(signal.size());
+    auto t1 = high_resolution_clock::now();
+    for (int i = 0; i < signal.size(); ++i) {
+        legacy_output[i] = legacy_apply_filter(coefficients, legacy_history, signal[i]);
+    }
+    auto t2 = high_resolution_clock::now();
+    duration<double, nano> legacy_time = t2 - t1;
+
+    vector<double> ring_output(signal.size());
+    t1 = high_resolution_clock::now();
+    for (int i = 0; i < signal.size(); ++i) {
+        ring_output[i] = filter.apply_filter(signal[i]);
+    }
+    t2 = high_resolution_clock::now();
+    duration<double, nano> ring_time = t2 - t1;
+
+    // both implementations must produce the same output
+    double max_difference = 0.0;
+    for (int i = 0; i < signal.size(); ++i) {
+        max_difference = max(max_difference, fabs(legacy_output[i] - ring_output[i]));
+    }
+
+    double legacy_per_sample = legacy_time.count() / signal.size();
+    double ring_per_sample = ring_time.count() / signal.size();
+    cout << coefficients.size() << " coefficients:" << endl
+         << "    Shifting history: " << legacy_per_sample << " ns/sample" << endl
+         << "    Ring buffer:      " << ring_per_sample << " ns/sample" << endl
+         << "    Speed up: " << legacy_per_sample / ring_per_sample << "x"
+         << " (max difference = " << max_difference << ")" << endl;
+}
+
+static void benchmark_fir_convolution(const vector<double>& signal, double sample_rate, int num_taps) {
+    /* Compares direct form FIR filtering against FFT convolution (overlap-add and overlap-save)
+     *
+     * param signal: Signal to filter
+     * param sample_rate: Sample rate of the signal
+     * param num_taps: Number of filter coefficients = (2 * num_taps) + 1
+     */
+
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        band_pass, sample_rate, {200.0, 3000.0}, num_taps
+    );
+    cout << filter.get_coefficients().size() << " coefficients:" << endl;
+
+    vector<double> direct_output(signal.size());
+    for (ConvolutionMode convolution_mode : {direct_form, overlap_add, overlap_save}) {
+        filter.set_convolution_mode(convolution_mode);
+
+        vector<double> output(signal.size());
+        auto t1 = high_resolution_clock::now();
+        filter.apply_filter_block(signal.data(), output.data(), signal.size());
+        auto t2 = high_resolution_clock::now();
+        duration<double, nano> filter_time = t2 - t1;
+
+        string mode_name = "Direct form:  ";
+        if (convolution_mode == overlap_add) mode_name = "Overlap-add:  ";
+        else if (convolution_mode == overlap_save) mode_name = "Overlap-save: ";
+        cout << "    " << mode_name << filter_time.count() / signal.size() << " ns/sample";
+
+        if (convolution_mode == direct_form) {
+            direct_output = output;
+            cout << endl;
+            continue;
+        }
+        // FFT convolution must match the direct form (within rounding error)
+        double max_difference = 0.0;
+        for (int i = 0; i < signal.size(); ++i) {
+            max_difference = max(max_difference, fabs(direct_output[i] - output[i]));
+        }
+        cout << " (max difference = " << max_difference << ")" << endl;
+    }
+}
+
+static void benchmark_fft(int fft_size) {
+    /* Times a forward and inverse FFT pair and checks the round trip error
+     *
+     * param fft_size: Number of points in the transform (power of 2)
+     */
+
+    FFTPlan plan = FFTPlan(fft_size);
+    vector<complex<double>> original(fft_size);
+    for (int i = 0; i < fft_size; ++i) {
+        original[i] = complex<double>(sin(0.1 * i), cos(0.37 * i));
+    }
+    vector<complex<double>> data = original;
+
+    int repeats = max(1, (1 << 22) / fft_size);
+    auto t1 = high_resolution_clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        fft(data.data(), plan);
+        inv_fft(data.data(), plan);
+    }
+    auto t2 = high_resolution_clock::now();
+    duration<double, micro> fft_time = t2 - t1;
+
+    // a single round trip must return the original data
+    data = original;
+    fft(data.data(), plan);
+    inv_fft(data.data(), plan);
+    double max_difference = 0.0;
+    for (int i = 0; i < fft_size; ++i) {
+        max_difference = max(max_difference, abs(original[i] - data[i]));
+    }
+    cout << fft_size << " points:" << endl
+         << "    Complex FFT: " << fft_time.count() / repeats << " us per forward + inverse"
+         << " (round trip error = " << max_difference << ")" << endl;
+
+    // real signals can use the packed half size transform instead
+    RealFFTPlan real_plan = RealFFTPlan(fft_size);
+    vector<double> real_original(fft_size);
+    for (int i = 0; i < fft_size; ++i) {
+        real_original[i] = sin(0.1 * i) + cos(0.37 * i);
+    }
+    vector<double> real_data = real_original;
+    vector<complex<double>> spectrum(real_plan.get_num_bins());
+
+    t1 = high_resolution_clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        real_fft(real_data.data(), spectrum.data(), real_plan);
+        inv_real_fft(spectrum.data(), real_data.data(), real_plan);
+    }
+    t2 = high_resolution_clock::now();
+    duration<double, micro> real_fft_time = t2 - t1;
+
+    real_data = real_original;
+    real_fft(real_data.data(), spectrum.data(), real_plan);
+    inv_real_fft(spectrum.data(), real_data.data(), real_plan);
+    max_difference = 0.0;
+    for (int i = 0; i < fft_size; ++i) {
+        max_difference = max(max_difference, fabs(real_original[i] - real_data[i]));
+    }
+    cout << "    Real FFT:    " << real_fft_time.count() / repeats << " us per forward + inverse"
+         << " (round trip error = " << max_difference << ")" << endl;
+}
+
+static void benchmark_simd_kernels(const vector<double>& signal, double sample_rate, int num_taps) {
+    /* Compares the direct form FIR kernels for each supported instruction set
+     *
+     * param signal: Signal to filter
+     * param sample_rate: Sample rate of the signal
+     * param num_taps: Number of filter coefficients = (2 * num_taps) + 1
+     */
+
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        low_pass, sample_rate, {sample_rate / 10.0}, num_taps
+    );
+    vector<double> coefficients = filter.get_coefficients();
+    vector<double> reversed_coefficients(coefficients.rbegin(), coefficients.rend());
+    int num_coefficients = (int) coefficients.size();
+    int num_outputs = (int) signal.size() - num_coefficients;
+    cout << num_coefficients << " coefficients:" << endl;
+
+    // single precision copies (twice as many samples per register)
+    vector<float> float_reversed_coefficients(reversed_coefficients.begin(), reversed_coefficients.end());
+    vector<float> float_signal(signal.begin(), signal.end());
+
+    vector<double> scalar_output(num_outputs);
+    double scalar_per_sample = 0.0;
+    for (SimdLevel simd_level : {scalar_simd, sse2_simd, avx2_simd, avx512_simd}) {
+        if (simd_level > detect_simd_level()) break;
+
+        // each output is a dot product with a sliding window of the signal (as in apply_filter)
+        vector<double> output(num_outputs);
+        auto t1 = high_resolution_clock::now();
+        for (int i = 0; i < num_outputs; ++i) {
+            output[i] = dot_product(coefficients.data(), &signal[i], num_coefficients, simd_level);
+        }
+        auto t2 = high_resolution_clock::now();
+        duration<double, nano> dot_product_time = t2 - t1;
+
+        // neighbouring outputs are calculated together (as in apply_filter_block)
+        vector<double> block_output(num_outputs);
+        t1 = high_resolution_clock::now();
+        fir_block(reversed_coefficients.data(), num_coefficients, signal.data(), block_output.data(), num_outputs, simd_level);
+        t2 = high_resolution_clock::now();
+        duration<double, nano> block_time = t2 - t1;
+
+        // pairs of inputs that share a coefficient are added first (half the multiplies for linear phase filters)
+        vector<double> folded_output(num_outputs);
+        t1 = high_resolution_clock::now();
+        fir_block_folded(
+            reversed_coefficients.data(), num_coefficients, filter.get_coefficient_symmetry(),
+            signal.data(), folded_output.data(), num_outputs, simd_level
+        );
+        t2 = high_resolution_clock::now();
+        duration<double, nano> folded_time = t2 - t1;
+
+        vector<float> float_output(num_outputs);
+        t1 = high_resolution_clock::now();
+        fir_block_folded(
+            float_reversed_coefficients.data(), num_coefficients, filter.get_coefficient_symmetry(),
+            float_signal.data(), float_output.data(), num_outputs, simd_level
+        );
+        t2 = high_resolution_clock::now();
+        duration<double, nano> float_time = t2 - t1;
+
+        double dot_product_per_sample = dot_product_time.count() / num_outputs;
+        double block_per_sample = block_time.count() / num_outputs;
+        double folded_per_sample = folded_time.count() / num_outputs;
+        double float_per_sample = float_time.count() / num_outputs;
+        if (simd_level == scalar_simd) {
+            scalar_output = output;
+            scalar_per_sample = dot_product_per_sample;
+        }
+        double max_difference = 0.0;
+        for (int i = 0; i < num_outputs; ++i) {
+            max_difference = max(max_difference, fabs(scalar_output[i] - output[i]));
+            max_difference = max(max_difference, fabs(scalar_output[i] - block_output[i]));
+            max_difference = max(max_difference, fabs(scalar_output[i] - folded_output[i]));
+        }
+        // float results are compared separately as they are expected to differ by ~1e-7
+        double float_difference = 0.0;
+        for (int i = 0; i < num_outputs; ++i) {
+            float_difference = max(float_difference, fabs(scalar_output[i] - float_output[i]));
+        }
+        cout << "    " << get_simd_level_name(simd_level) << ":" << endl
+             << "        Per sample: " << dot_product_per_sample << " ns/sample"
+             << " (speed up = " << scalar_per_sample / dot_product_per_sample << "x)" << endl
+             << "        Block:      " << block_per_sample << " ns/sample"
+             << " (speed up = " << scalar_per_sample / block_per_sample << "x)" << endl
+             << "        Folded:     " << folded_per_sample << " ns/sample"
+             << " (speed up = " << scalar_per_sample / folded_per_sample << "x, max difference = "
+             << max_difference << ")" << endl
+             << "        Float:      " << float_per_sample << " ns/sample"
+             << " (speed up = " << scalar_per_sample / float_per_sample << "x, max difference = "
+             << float_difference << ")" << endl;
+    }
+}
+
+static void benchmark_decimation(const vector<double>& signal, double sample_rate, int decimation_factor) {
+    /* Compares filtering at the full rate then keeping every Mth output with the polyphase decimating filter
+     *
+     * param signal: Signal to filter
+     * param sample_rate: Sample rate of the signal
+     * param decimation_factor: Number of inputs per output (M)
+     */
+
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        low_pass, sample_rate, {sample_rate / (2.5 * decimation_factor)}, 50
+    );
+    DecimatingFIRFilter decimating_filter = DecimatingFIRFilter(filter.get_coefficients(), decimation_factor);
+    size_t length = signal.size();
+
+    vector<double> full_rate_output(length);
+    vector<double> kept_output(decimating_filter.get_max_output_length(length));
+    auto t1 = high_resolution_clock::now();
+    filter.apply_filter_block(signal.data(), full_rate_output.data(), length);
+    for (size_t i = 0; i < kept_output.size(); ++i) kept_output[i] = full_rate_output[i * decimation_factor];
+    auto t2 = high_resolution_clock::now();
+    duration<double, nano> full_rate_time = t2 - t1;
+
+    vector<double> decimated_output(decimating_filter.get_max_output_length(length));
+    t1 = high_resolution_clock::now();
+    size_t num_outputs = decimating_filter.apply_filter_block(signal.data(), decimated_output.data(), length);
+    t2 = high_resolution_clock::now();
+    duration<double, nano> decimated_time = t2 - t1;
+
+    double max_difference = 0.0;
+    for (size_t i = 0; i < num_outputs; ++i) {
+        max_difference = max(max_difference, fabs(kept_output[i] - decimated_output[i]));
+    }
+    double full_rate_per_sample = full_rate_time.count() / length;
+    double decimated_per_sample = decimated_time.count() / length;
+    cout << "M = " << decimation_factor << ": " << full_rate_per_sample << " ns/input (filter then discard), "
+         << decimated_per_sample << " ns/input (polyphase), speed up = "
+         << full_rate_per_sample / decimated_per_sample << "x, max difference = " << max_difference << endl;
+}
+
+static void benchmark_resampling(const vector<double>& signal, int input_rate, int output_rate) {
+    /* Times the rational resampler (the signal is treated as if it was sampled at input_rate)
+     *
+     * param signal: Signal to resample
+     * param input_rate: Sample rate of the signal
+     * param output_rate: Sample rate to convert to
+     */
+
+    auto t1 = high_resolution_clock::now();
+    RationalResampler resampler = RationalResampler(input_rate, output_rate);
+    auto t2 = high_resolution_clock::now();
+    duration<double, milli> design_time = t2 - t1;
+
+    vector<double> output(resampler.get_max_output_length(signal.size()));
+    t1 = high_resolution_clock::now();
+    size_t num_outputs = resampler.apply_filter_block(signal.data(), output.data(), signal.size());
+    t2 = high_resolution_clock::now();
+    duration<double, nano> resample_time = t2 - t1;
+
+    cout << input_rate << " Hz -> " << output_rate << " Hz (L/M = " << resampler.get_up_factor() << "/"
+         << resampler.get_down_factor() << "): " << resample_time.count() / num_outputs << " ns/output, "
+         << design_time.count() << "ms to design, delay = " << resampler.get_delay() << " samples" << endl;
+}
+
+static void benchmark_coefficient_cache(double sample_rate, int num_taps) {
+    /* Compares designing a filter every time with creating it from the coefficient cache
+     *
+     * param sample_rate: Sample rate the filters are designed for
+     * param num_taps: Number of taps (total number of coefficients = (2 * num_taps) + 1)
+     */
+
+    int num_filters = 100;
+    FirDesign design = {band_pass, sample_rate, {200.0, 3000.0}, num_taps, hamming};
+    // long filters are applied using FFT convolution, so their spectra are calculated (or cached) as well
+    ConvolutionMode convolution_mode = ((2 * num_taps) + 1 >= fft_convolution_threshold) ? overlap_save : direct_form;
+
+    auto t1 = high_resolution_clock::now();
+    vector<double> designed_coefficients;
+    for (int i = 0; i < num_filters; ++i) {
+        FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+            design.filter_type, sample_rate, design.cut_off_frequencies, num_taps
+        );
+        filter.apply_window(design.window_function);
+        filter.set_convolution_mode(convolution_mode);
+        designed_coefficients = filter.get_coefficients();
+    }
+    auto t2 = high_resolution_clock::now();
+    duration<double, micro> design_time = t2 - t1;
+
+    // a separate cache is used so the shared cache (and its file) is unaffected
+    CoefficientCache cache;
+    cache.create_filter(design, convolution_mode);
+    t1 = high_resolution_clock::now();
+    vector<double> cached_coefficients;
+    for (int i = 0; i < num_filters; ++i) {
+        FiniteImpulseResponseFilter filter = cache.create_filter(design, convolution_mode);
+        cached_coefficients = filter.get_coefficients();
+    }
+    t2 = high_resolution_clock::now();
+    duration<double, micro> cached_time = t2 - t1;
+
+    cout << (2 * num_taps) + 1 << " coefficients (" << (convolution_mode == direct_form ? "direct form" : "overlap-save")
+         << "): designed = " << design_time.count() / num_filters << " us/filter, cached = "
+         << cached_time.count() / num_filters << " us/filter, "
+         << design_time.count() / cached_time.count() << "x, identical = "
+         << (designed_coefficients == cached_coefficients ? "yes" : "no") << endl;
+}
+
+static void benchmark_sample_conversion(const vector<double>& signal, int num_channels) {
+    /* Compares the int16 <-> double conversion kernels (with interleaving) for each supported instruction set
+     *
+     * param signal: Signal to use for every channel
+     * param num_channels: Number of interleaved channels
+     */
+
+    int num_frames = (int) signal.size();
+    // the signal is scaled down so nothing is clipped
+    vector<vector<double>> channels(num_channels, vector<double>(num_frames));
+    vector<const double *> input_pointers;
+    for (int j = 0; j < num_channels; ++j) {
+        for (int i = 0; i < num_frames; ++i) channels[j][i] = signal[i] / (2.0 + j);
+        input_pointers.push_back(channels[j].data());
+    }
+    vector<vector<double>> converted(num_channels, vector<double>(num_frames));
+    vector<double *> output_pointers;
+    for (vector<double>& channel : converted) output_pointers.push_back(channel.data());
+    vector<signed short> interleaved(num_frames * num_channels);
+    cout << num_channels << " channel(s):" << endl;
+
+    double scalar_per_frame = 0.0;
+    vector<signed short> scalar_interleaved;
+    for (SimdLevel simd_level : {scalar_simd, sse2_simd, avx2_simd}) {
+        if (simd_level > detect_simd_level()) break;
+
+        auto t1 = high_resolution_clock::now();
+        interleave_double_to_int16(input_pointers.data(), num_channels, num_frames, interleaved.data(), simd_level);
+        auto t2 = high_resolution_clock::now();
+        duration<double, nano> interleave_time = t2 - t1;
+
+        t1 = high_resolution_clock::now();
+        deinterleave_int16_to_double(
+            interleaved.data(), num_channels, num_frames, output_pointers.data(), simd_level
+        );
+        t2 = high_resolution_clock::now();
+        duration<double, nano> deinterleave_time = t2 - t1;
+
+        double per_frame = (interleave_time.count() + deinterleave_time.count()) / num_frames;
+        if (simd_level == scalar_simd) {
+            scalar_per_frame = per_frame;
+            scalar_interleaved = interleaved;
+        }
+        cout << "    " << get_simd_level_name(simd_level) << ": "
+             << interleave_time.count() / num_frames << " ns/frame (interleave), "
+             << deinterleave_time.count() / num_frames << " ns/frame (deinterleave), speed up = "
+             << scalar_per_frame / per_frame << "x, identical = "
+             << (interleaved == scalar_interleaved ? "yes" : "no") << endl;
+    }
+}
+
+static void benchmark_fixed_point(const vector<double>& signal, double sample_rate, int num_taps) {
+    /* Compares filtering 16 bit samples through doubles (convert, filter, convert back) with the fixed point filter
+     *
+     * param signal: Signal to filter (scaled to 16 bit samples)
+     * param sample_rate: Sample rate of the signal
+     * param num_taps: Number of filter coefficients = (2 * num_taps) + 1
+     */
+
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        low_pass, sample_rate, {sample_rate / 10.0}, num_taps
+    );
+    FixedPointFIRFilter fixed_point_filter = FixedPointFIRFilter(filter.get_coefficients());
+    size_t length = signal.size();
+    // the signal is scaled down so nothing is clipped
+    vector<double> scaled_signal(length);
+    for (size_t i = 0; i < length; ++i) scaled_signal[i] = signal[i] / 2.0;
+    vector<signed short> samples(length);
+    double_to_int16(scaled_signal.data(), samples.data(), length);
+
+    vector<double> converted(length), filtered(length);
+    vector<signed short> double_output(length);
+    auto t1 = high_resolution_clock::now();
+    int16_to_double(samples.data(), converted.data(), length);
+    filter.apply_filter_block(converted.data(), filtered.data(), length);
+    double_to_int16(filtered.data(), double_output.data(), length);
+    auto t2 = high_resolution_clock::now();
+    duration<double, nano> double_time = t2 - t1;
+
+    vector<signed short> fixed_point_output(length);
+    t1 = high_resolution_clock::now();
+    fixed_point_filter.apply_filter_block(samples.data(), fixed_point_output.data(), length);
+    t2 = high_resolution_clock::now();
+    duration<double, nano> fixed_point_time = t2 - t1;
+
+    int max_difference = 0;
+    for (size_t i = 0; i < length; ++i) {
+        max_difference = max(max_difference, abs(double_output[i] - fixed_point_output[i]));
+    }
+    double double_per_sample = double_time.count() / length;
+    double fixed_point_per_sample = fixed_point_time.count() / length;
+    cout << filter.get_coefficients().size() << " coefficients (Q" << fixed_point_filter.get_fraction_bits()
+         << ", " << (fixed_point_filter.uses_wide_accumulator() ? "64" : "32") << " bit sums):" << endl
+         << "    Double:      " << double_per_sample << " ns/sample" << endl
+         << "    Fixed point: " << fixed_point_per_sample << " ns/sample"
+         << " (speed up = " << double_per_sample / fixed_point_per_sample << "x, max difference = "
+         << max_difference << " LSB)" << endl;
+}
+
+void run_benchmarks() {
+    /* Times the filtering code on a generated signal (results are printed) */
+
+    double sample_rate = 44100.0;
+    int signal_length = 1 << 18;
+    vector<double> signal = generate_benchmark_signal(signal_length, sample_rate);
+
+    cout << endl << "FIR delay line benchmark (" << signal_length << " samples)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_taps : {25, 100, 500}) {
+        benchmark_fir_history(signal, sample_rate, num_taps);
+    }
+
+    cout << endl << "FIR SIMD kernel benchmark (" << signal_length << " samples, "
+         << get_simd_level_name(detect_simd_level()) << " supported)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_taps : {25, 50, 100}) {
+        benchmark_simd_kernels(signal, sample_rate, num_taps);
+    }
+
+    cout << endl << "Decimating FIR benchmark (" << signal_length << " samples, 101 coefficients)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int decimation_factor : {2, 4, 8, 16}) {
+        benchmark_decimation(signal, sample_rate, decimation_factor);
+    }
+
+    cout << endl << "Resampling benchmark (" << signal_length << " samples)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (const vector<int>& rates : vector<vector<int>>{{44100, 48000}, {48000, 44100}, {44100, 96000}, {96000, 48000}}) {
+        benchmark_resampling(signal, rates[0], rates[1]);
+    }
+
+    cout << endl << "Coefficient cache benchmark (100 filters)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_taps : {50, 500, 2000}) {
+        benchmark_coefficient_cache(sample_rate, num_taps);
+    }
+
+    cout << endl << "Sample conversion benchmark (" << signal_length << " frames)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_channels : {1, 2, 4}) {
+        benchmark_sample_conversion(signal, num_channels);
+    }
+
+    cout << endl << "Fixed point FIR benchmark (" << signal_length << " samples)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_taps : {25, 50, 100}) {
+        benchmark_fixed_point(signal, sample_rate, num_taps);
+    }
+
+    cout << endl << "FFT benchmark" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int fft_size : {256, 4096, 65536}) {
+        benchmark_fft(fft_size);
+    }
+
+    cout << endl << "FIR convolution benchmark (" << signal_length << " samples)" << endl;
+    cout << "---------------------------------------" << endl;
+    for (int num_taps : {25, 100, 500, 1000}) {
+        benchmark_fir_convolution(signal, sample_rate, num_taps);
+    }
+}
+
+#endif
@@ -0,0 +1,51 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <complex>
+
+#ifndef FIR_KERNELS_HPP
+#include "fir_kernels.hpp"
+#endif
+
+#ifndef SAMPLE_CONVERSION_HPP
+#include "sample_conversion.hpp"
+#endif
+
+#ifndef FFT_HPP
+#include "fft.hpp"
+#endif
+
+#ifndef FIR_FILTER_HPP
+#include "classes/FiniteImpulseResponseFilter.hpp"
+#endif
+
+#ifndef DECIMATING_FIR_FILTER_HPP
+#include "classes/DecimatingFIRFilter.hpp"
+#endif
+
+#ifndef RATIONAL_RESAMPLER_HPP
+#include "classes/RationalResampler.hpp"
+#endif
+
+#ifndef COEFFICIENT_CACHE_HPP
+#include "classes/CoefficientCache.hpp"
+#endif
+
+#ifndef FIXED_POINT_FIR_FILTER_HPP
+#include "classes/FixedPointFIRFilter.hpp"
+#endif
+
+void run_benchmarks();
+
+#endif //BENCHMARKS_HPP
@@ -0,0 +1,422 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef COEFFICIENT_CACHE_HPP
+
+#include "CoefficientCache.hpp"
+
+static_assert(sizeof(CoefficientRecordHeader) == 32, "The coefficient record header must be 32 bytes");
+
+bool operator<(const FirDesign& design_1, const FirDesign& design_2) {
+    /* Orders designs so they can be used as map keys (parameters must match exactly to share coefficients) */
+
+    return std::tie(
+        design_1.filter_type,
+        design_1.sampling_frequency,
+        design_1.cut_off_frequencies,
+        design_1.num_taps,
+        design_1.window_function
+    ) < std::tie(
+        design_2.filter_type,
+        design_2.sampling_frequency,
+        design_2.cut_off_frequencies,
+        design_2.num_taps,
+        design_2.window_function
+    );
+}
+
+static void check_design(const FirDesign& design) {
+    /* Throws if a design cannot be turned into coefficients */
+
+    if (design.filter_type < low_pass || design.filter_type > band_stop) {
+        throw std::invalid_argument("Unknown filter type!");
+    }
+    if (design.window_function < rectangular || design.window_function > blackman) {
+        throw std::invalid_argument("Unknown window function!");
+    }
+    std::size_t num_cut_off_frequencies = (design.filter_type == low_pass || design.filter_type == high_pass) ? 1 : 2;
+    if (design.cut_off_frequencies.size() != num_cut_off_frequencies) {
+        throw std::invalid_argument("Low pass and high pass filters need 1 cut off frequency, others need 2!");
+    }
+    if (design.num_taps < 0) {
+        throw std::invalid_argument("Number of taps must not be negative!");
+    }
+}
+
+CoefficientCache::CoefficientCache(std::size_t max_designs) {
+    /* Empty cache constructor (get_instance() should be used to share designs across the program)
+     *
+     * param max_designs: Maximum number of designs kept (filters that are still in use keep their shared copies)
+     */
+
+    if (max_designs == 0) {
+        throw std::invalid_argument("Coefficient cache must be able to hold at least 1 design!");
+    }
+    this->max_designs = max_designs;
+    use_counter = 0;
+    num_hits = 0;
+    num_misses = 0;
+    has_unsaved_designs = false;
+}
+
+CoefficientCache& CoefficientCache::get_instance() {
+    /*
+     * return: The cache shared by the whole process (created by the first call)
+     */
+
+    static CoefficientCache instance;
+    return instance;
+}
+
+std::vector<double> CoefficientCache::design_coefficients(const FirDesign& design) {
+    /* Designs the coefficients of an FIR filter (without the cache)
+     *
+     * param design: Parameters of the filter
+     * return: Coefficients (same as FiniteImpulseResponseFilter::get_coefficients() after apply_window())
+     */
+
+    check_design(design);
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
+        design.filter_type, design.sampling_frequency, design.cut_off_frequencies, design.num_taps
+    );
+    // a rectangular window leaves the coefficients unchanged
+    if (design.window_function != rectangular) {
+        filter.apply_window(design.window_function);
+    }
+    return filter.get_coefficients();
+}
+
+std::shared_ptr<const std::vector<double>> CoefficientCache::get_coefficients(const FirDesign& design) {
+    /* Finds the coefficients of a design, designing them if they are not cached
+     *
+     * param design: Parameters of the filter
+     * return: Coefficients (shared, so they must not be modified)
+     */
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto found = entries.find(design);
+        if (found != entries.end()) {
+            ++num_hits;
+            found->second.last_used = ++use_counter;
+            return found->second.coefficients;
+        }
+        ++num_misses;
+    }
+
+    // designed without the lock so other designs can be looked up meanwhile
+    auto coefficients = std::make_shared<const std::vector<double>>(design_coefficients(design));
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    // another thread may have designed the same filter first (its copy is kept so everyone shares one)
+    auto inserted = entries.emplace(design, CacheEntry());
+    inserted.first->second.last_used = ++use_counter;
+    if (inserted.second) {
+        inserted.first->second.coefficients = coefficients;
+        has_unsaved_designs = true;
+        remove_least_recently_used();
+    }
+    return inserted.first->second.coefficients;
+}
+
+void CoefficientCache::remove_least_recently_used() {
+    /* Removes the least recently used designs until the cache is within its size (cache_mutex must be locked) */
+
+    while (entries.size() > max_designs) {
+        auto oldest = entries.begin();
+        for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+            if (entry->second.last_used < oldest->second.last_used) {
+                oldest = entry;
+            }
+        }
+        entries.erase(oldest);
+    }
+}
+
+template <typename Sample>
+SharedCoefficientSpectrum<Sample> CoefficientCache::get_spectrum(
+    const FirDesign& design, SharedCoefficientSpectrum<Sample> CacheEntry::* spectrum_member
+) {
+    /* Finds the FFT of a design's coefficients, calculating it (and the coefficients) if it is not cached
+     *
+     * param design: Parameters of the filter
+     * param spectrum_member: Spectrum of the cache entry to use (double or float precision)
+     * return: Spectrum for a BasicFastConvolutionEngine<Sample> with the design's coefficients
+     */
+
+    std::shared_ptr<const std::vector<double>> coefficients;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto found = entries.find(design);
+        if (found != entries.end()) {
+            if (found->second.*spectrum_member != nullptr) {
+                return found->second.*spectrum_member;
+            }
+            coefficients = found->second.coefficients;
+        }
+    }
+    if (coefficients == nullptr) {
+        coefficients = get_coefficients(design);
+    }
+
+    SharedCoefficientSpectrum<Sample> spectrum =
+        BasicFastConvolutionEngine<Sample>::calculate_coefficient_spectrum(*coefficients);
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto found = entries.find(design);
+    // the entry may have been cleared while the FFT was calculated (the spectrum is then returned uncached)
+    if (found == entries.end() || found->second.coefficients != coefficients) {
+        return spectrum;
+    }
+    if (found->second.*spectrum_member == nullptr) {
+        found->second.*spectrum_member = spectrum;
+    }
+    return found->second.*spectrum_member;
+}
+
+SharedCoefficientSpectrum<double> CoefficientCache::get_coefficient_spectrum(const FirDesign& design) {
+    /*
+     * param design: Parameters of the filter
+     * return: FFT of the design's coefficients for double precision FFT convolution (shared)
+     */
+    return get_spectrum(design, &CacheEntry::coefficient_spectrum);
+}
+
+SharedCoefficientSpectrum<float> CoefficientCache::get_float_coefficient_spectrum(const FirDesign& design) {
+    /*
+     * param design: Parameters of the filter
+     * return: FFT of the design's coefficients for single precision FFT convolution (shared)
+     */
+    return get_spectrum(design, &CacheEntry::float_coefficient_spectrum);
+}
+
+FiniteImpulseResponseFilter CoefficientCache::create_filter(
+    const FirDesign& design, ConvolutionMode convolution_mode, SamplePrecision precision
+) {
+    /* Creates an FIR filter from cached coefficients (and cached FFTs when FFT convolution is used)
+     *
+     * param design: Parameters of the filter
+     * param convolution_mode: How the filter is applied (direct_form, overlap_add or overlap_save)
+     * param precision: Precision the filter will be applied in (only the spectrum it needs is calculated)
+     * return: The filter, with an empty input history
+     */
+
+    std::shared_ptr<const std::vector<double>> coefficients = get_coefficients(design);
+    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(design.sampling_frequency, *coefficients);
+    if (convolution_mode != direct_form) {
+        // the double precision engine is always created, the float engine only by single precision blocks
+        filter.set_coefficient_spectrum(get_coefficient_spectrum(design));
+        if (precision == single_precision) {
+            filter.set_coefficient_spectrum(get_float_coefficient_spectrum(design));
+        }
+        filter.set_convolution_mode(convolution_mode);
+    }
+    return filter;
+}
+
+bool CoefficientCache::load_file(const std::string& file_name) {
+    /* Adds the designs saved in a cache file (designs that are already cached are kept)
+     *
+     * param file_name: Name of the file written by save_file()
+     * return: False if the file does not exist (or cannot be opened), true if it was loaded
+     */
+
+    FILE * fp = fopen(file_name.c_str(), "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+
+    std::vector<std::pair<FirDesign, std::vector<double>>> loaded_designs;
+    try {
+        char magic[8];
+        std::uint32_t version, num_designs;
+        if (fread(magic, sizeof(magic), 1, fp) != 1 || memcmp(magic, coefficient_cache_magic, 8) != 0
+            || fread(&version, sizeof(version), 1, fp) != 1 || fread(&num_designs, sizeof(num_designs), 1, fp) != 1) {
+            throw std::runtime_error("File " + file_name + " is not a coefficient cache file!");
+        }
+        if (version != coefficient_cache_version) {
+            throw std::runtime_error("Coefficient cache file " + file_name + " uses an unsupported version!");
+        }
+        // sizes read from the file are checked against the bytes left in it before anything is allocated
+        long data_start = ftell(fp);
+        if (data_start < 0 || fseek(fp, 0, SEEK_END) != 0) {
+            throw std::runtime_error("Coefficient cache file " + file_name + " is corrupted!");
+        }
+        long file_size = ftell(fp);
+        if (file_size < data_start || fseek(fp, data_start, SEEK_SET) != 0) {
+            throw std::runtime_error("Coefficient cache file " + file_name + " is corrupted!");
+        }
+
+        for (std::uint32_t i = 0; i < num_designs; ++i) {
+            CoefficientRecordHeader record;
+            if (fread(&record, sizeof(record), 1, fp) != 1) {
+                throw std::runtime_error("Coefficient cache file " + file_name + " is too short!");
+            }
+
+            FirDesign design;
+            design.filter_type = (FilterType) record.filter_type;
+            design.sampling_frequency = record.sampling_frequency;
+            design.num_taps = record.num_taps;
+            design.window_function = (WindowFunction) record.window_function;
+            // the design is checked before any sizes from the file are used
+            design.cut_off_frequencies.resize(std::min<std::uint32_t>(record.num_cut_off_frequencies, 3));
+            check_design(design);
+            if (record.num_coefficients != 2 * (std::uint32_t) design.num_taps + 1) {
+                throw std::runtime_error("Coefficient cache file " + file_name + " is corrupted!");
+            }
+            long position = ftell(fp);
+            std::uint64_t num_values = (std::uint64_t) record.num_cut_off_frequencies + record.num_coefficients;
+            if (position < 0 || position > file_size
+                || num_values > (std::uint64_t) (file_size - position) / sizeof(double)) {
+                throw std::runtime_error("Coefficient cache file " + file_name + " is corrupted!");
+            }
+
+            std::vector<double> coefficients(record.num_coefficients);
+            std::size_t num_cut_off_frequencies = design.cut_off_frequencies.size();
+            if (fread(design.cut_off_frequencies.data(), sizeof(double), num_cut_off_frequencies, fp) != num_cut_off_frequencies
+                || fread(coefficients.data(), sizeof(double), coefficients.size(), fp) != coefficients.size()) {
+                throw std::runtime_error("Coefficient cache file " + file_name + " is too short!");
+            }
+            loaded_designs.emplace_back(design, std::move(coefficients));
+        }
+    }
+    catch (std::invalid_argument&) {
+        fclose(fp);
+        throw std::runtime_error("Coefficient cache file " + file_name + " is corrupted!");
+    }
+    catch (...) {
+        fclose(fp);
+        throw;
+    }
+    fclose(fp);
+
+    // nothing is added unless the whole file is valid
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (auto& loaded_design : loaded_designs) {
+        auto inserted = entries.emplace(loaded_design.first, CacheEntry());
+        if (inserted.second) {
+            inserted.first->second.coefficients =
+                std::make_shared<const std::vector<double>>(std::move(loaded_design.second));
+            // designs are saved least recently used first, so the newest designs are kept if the cache is full
+            inserted.first->second.last_used = ++use_counter;
+        }
+    }
+    remove_least_recently_used();
+    return true;
+}
+
+void CoefficientCache::save_file(const std::string& file_name) {
+    /* Writes the cached designs to a file (so a later run can load them instead of designing the filters)
+     *
+     * Designs with more than max_saved_coefficients coefficients are left out.
+     *
+     * param file_name: Name of the file (overwritten if it exists)
+     */
+
+    // the entries are copied (coefficients are shared, not copied) so the file is written without the lock
+    std::vector<std::pair<FirDesign, std::shared_ptr<const std::vector<double>>>> saved_designs;
+    std::vector<std::uint64_t> last_used;
+    std::size_t num_entries;
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        num_entries = entries.size();
+        for (const auto& entry : entries) {
+            if (entry.second.coefficients->size() <= max_saved_coefficients) {
+                saved_designs.emplace_back(entry.first, entry.second.coefficients);
+                last_used.push_back(entry.second.last_used);
+            }
+        }
+    }
+    // least recently used first (see load_file)
+    std::vector<std::size_t> order(saved_designs.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&last_used](std::size_t a, std::size_t b) {
+        return last_used[a] < last_used[b];
+    });
+
+    FILE * fp = fopen(file_name.c_str(), "wb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    auto num_designs = (std::uint32_t) saved_designs.size();
+    bool write_failed = fwrite(coefficient_cache_magic, sizeof(coefficient_cache_magic), 1, fp) != 1
+        || fwrite(&coefficient_cache_version, sizeof(coefficient_cache_version), 1, fp) != 1
+        || fwrite(&num_designs, sizeof(num_designs), 1, fp) != 1;
+    for (std::size_t index : order) {
+        if (write_failed) break;
+        const FirDesign& design = saved_designs[index].first;
+        const std::vector<double>& coefficients = *saved_designs[index].second;
+
+        CoefficientRecordHeader record;
+        memset(&record, 0, sizeof(record));
+        record.filter_type = design.filter_type;
+        record.window_function = design.window_function;
+        record.num_cut_off_frequencies = (std::uint32_t) design.cut_off_frequencies.size();
+        record.num_coefficients = (std::uint32_t) coefficients.size();
+        record.num_taps = design.num_taps;
+        record.sampling_frequency = design.sampling_frequency;
+
+        std::size_t num_cut_off_frequencies = design.cut_off_frequencies.size();
+        write_failed = fwrite(&record, sizeof(record), 1, fp) != 1
+            || fwrite(design.cut_off_frequencies.data(), sizeof(double), num_cut_off_frequencies, fp) != num_cut_off_frequencies
+            || fwrite(coefficients.data(), sizeof(double), coefficients.size(), fp) != coefficients.size();
+    }
+
+    if (fclose(fp) != 0 || write_failed) {
+        throw std::runtime_error("Unable to write file " + file_name + "!");
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    // designs added while the file was written are still unsaved
+    if (entries.size() == num_entries) {
+        has_unsaved_designs = false;
+    }
+}
+
+void CoefficientCache::clear() {
+    /* Removes every design (filters and spectra that are still in use keep their shared copies) */
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    entries.clear();
+    has_unsaved_designs = false;
+}
+
+bool CoefficientCache::has_unsaved_changes() {
+    /*
+     * return: True if designs have been added since the cache was last saved
+     */
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return has_unsaved_designs;
+}
+
+std::size_t CoefficientCache::get_size() {
+    /*
+     * return: Number of cached designs
+     */
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return entries.size();
+}
+
+std::size_t CoefficientCache::get_num_hits() {
+    /*
+     * return: Number of coefficient requests that were found in the cache
+     */
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return num_hits;
+}
+
+std::size_t CoefficientCache::get_num_misses() {
+    /*
+     * return: Number of coefficient requests that had to be designed
+     */
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return num_misses;
+}
+
+#endif
@@ -0,0 +1,123 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef COEFFICIENT_CACHE_HPP
+#define COEFFICIENT_CACHE_HPP
+
+#include <vector>
+#include <map>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <algorithm>
+
+#ifndef FIR_FILTER_HPP
+#include "FiniteImpulseResponseFilter.hpp"
+#endif
+
+/* Coefficient cache file layout (little endian):
+ *
+ * 16 byte header (magic, version, number of designs), followed by one record per design: a
+ * CoefficientRecordHeader, the cut off frequencies and then the coefficients (all doubles).
+ * Only coefficients are stored, FFTs of the coefficients are recalculated when they are first requested.
+ */
+
+const char coefficient_cache_magic[8] = {'D', 'F', 'C', 'O', 'E', 'F', 'F', 'S'};
+const std::uint32_t coefficient_cache_version = 1;
+
+// designs kept in memory by default (the least recently used design is removed to make room for a new one)
+const std::size_t default_max_cached_designs = 64;
+// longer designs (e.g. resampler filters) are not saved to cache files, so the files stay small
+const std::size_t max_saved_coefficients = 4097;
+
+typedef struct fir_design {
+    /* Parameters that fully determine the coefficients of an FIR filter */
+
+    FilterType filter_type;
+    double sampling_frequency;
+    std::vector<double> cut_off_frequencies;  // 1 value for low pass and high pass, 2 for band pass and band stop
+    int num_taps;  // total number of coefficients = (2 * num_taps) + 1
+    WindowFunction window_function;
+} FirDesign;
+
+bool operator<(const FirDesign& design_1, const FirDesign& design_2);
+
+typedef struct coefficient_record_header {
+    std::uint32_t filter_type;
+    std::uint32_t window_function;
+    std::uint32_t num_cut_off_frequencies;
+    std::uint32_t num_coefficients;
+    std::int32_t num_taps;
+    std::uint32_t reserved;  // zero
+    double sampling_frequency;
+} CoefficientRecordHeader;
+
+class CoefficientCache {
+    /* Cache of designed FIR coefficients (thread safe)
+     *
+     * Designing a filter calculates a sin() for every tap, so filtering many signals with the same specification
+     * repeats the same work. Each FirDesign is designed once, then every request shares the same read only
+     * coefficients (and FFTs of the coefficients for FFT convolution). get_instance() returns the cache that is
+     * shared by the whole process. Only the most recently used designs are kept, and they are only saved to (or
+     * loaded from) a file when save_file() (or load_file()) is called.
+     */
+
+    private:
+        typedef struct cache_entry {
+            std::shared_ptr<const std::vector<double>> coefficients;
+            // calculated the first time they are requested
+            SharedCoefficientSpectrum<double> coefficient_spectrum;
+            SharedCoefficientSpectrum<float> float_coefficient_spectrum;
+            std::uint64_t last_used;  // value of use_counter when the design was last requested
+        } CacheEntry;
+
+        std::map<FirDesign, CacheEntry> entries;
+        std::mutex cache_mutex;
+        std::size_t max_designs;
+        std::uint64_t use_counter;
+        std::size_t num_hits;
+        std::size_t num_misses;
+        bool has_unsaved_designs;  // designs have been added since the cache was last saved
+
+        void remove_least_recently_used();
+        template <typename Sample>
+        SharedCoefficientSpectrum<Sample> get_spectrum(
+            const FirDesign& design, SharedCoefficientSpectrum<Sample> CacheEntry::* spectrum_member
+        );
+
+    public:
+        explicit CoefficientCache(std::size_t max_designs = default_max_cached_designs);
+
+        CoefficientCache(const CoefficientCache&) = delete;
+        CoefficientCache& operator=(const CoefficientCache&) = delete;
+
+        static CoefficientCache& get_instance();
+        static std::vector<double> design_coefficients(const FirDesign& design);
+
+        std::shared_ptr<const std::vector<double>> get_coefficients(const FirDesign& design);
+        SharedCoefficientSpectrum<double> get_coefficient_spectrum(const FirDesign& design);
+        SharedCoefficientSpectrum<float> get_float_coefficient_spectrum(const FirDesign& design);
+        FiniteImpulseResponseFilter create_filter(
+            const FirDesign& design,
+            ConvolutionMode convolution_mode = direct_form,
+            SamplePrecision precision = double_precision
+        );
+
+        bool load_file(const std::string& file_name);
+        void save_file(const std::string& file_name);
+        void clear();
+
+        bool has_unsaved_changes();
+        std::size_t get_size();
+        std::size_t get_num_hits();
+        std::size_t get_num_misses();
+};
+
+#endif //COEFFICIENT_CACHE_HPP
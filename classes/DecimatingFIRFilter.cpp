@@ -0,0 +1,115 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef DECIMATING_FIR_FILTER_HPP
+
+#include "DecimatingFIRFilter.hpp"
+
+DecimatingFIRFilter::DecimatingFIRFilter(const std::vector<double>& coefficients, int decimation_factor) {
+    /* Decimating FIR filter constructor
+     *
+     * param coefficients: Filter coefficients (e.g. a low pass FiniteImpulseResponseFilter with a cut off below
+     *     sampling_frequency / (2 * decimation_factor) to prevent aliasing)
+     * param decimation_factor: Number of inputs per output (M)
+     */
+
+    if (decimation_factor < 1) {
+        throw std::invalid_argument("Decimation factor must be at least 1!");
+    }
+    this->decimation_factor = decimation_factor;
+    b_coefficients = coefficients;
+    reversed_branches = split_polyphase(coefficients, decimation_factor);
+    branch_length = (int) reversed_branches[0].size();
+    reset();
+}
+
+void DecimatingFIRFilter::reset() {
+    /* Clears the input history (as if all previous inputs were 0), so the next input gives an output */
+
+    block_buffer.assign(branch_length * decimation_factor - 1, 0.0);
+    next_output_offset = 0;
+}
+
+std::size_t DecimatingFIRFilter::apply_filter_block(const double * input, double * output, std::size_t length) {
+    /* Filters and downsamples a block of samples (continues from the previous block)
+     *
+     * Outputs are kept at every Mth input (counting from the first input after construction or reset), so the
+     * number of outputs from a block depends on where the previous block stopped.
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least get_max_output_length(length) elements) that receives the
+     *     filtered samples
+     * param length: Number of samples in the block
+     * return: Number of outputs written
+     */
+
+    const int chunk_length = 4096;  // bounds the size of the block buffer
+    int num_previous = branch_length * decimation_factor - 1;
+    block_buffer.resize(num_previous + chunk_length);
+
+    std::size_t num_outputs = 0;
+    std::size_t position = 0;
+    while (position < length) {
+        int num_inputs = (int) std::min<std::size_t>(chunk_length, length - position);
+        // the previous inputs are already at the start of the buffer
+        std::copy(input + position, input + position + num_inputs, block_buffer.begin() + num_previous);
+
+        int num_kept = (num_inputs > next_output_offset)
+            ? (num_inputs - 1 - next_output_offset) / decimation_factor + 1 : 0;
+        if (num_kept > 0) {
+            // y[m] = sum{p=0->M-1} sum{q=0->L-1}(h_p[q] * x[(m - q)M - p]), so each branch is a short FIR on every
+            // Mth input (starting p inputs before the kept ones)
+            int first_kept = num_previous + next_output_offset;
+            int branch_input_length = num_kept + branch_length - 1;
+            branch_input.resize(branch_input_length);
+            branch_output.resize(num_kept);
+            double * chunk_output = output + num_outputs;
+            for (int p = 0; p < decimation_factor; ++p) {
+                const double * branch_start = &block_buffer[first_kept - p - (branch_length - 1) * decimation_factor];
+                for (int j = 0; j < branch_input_length; ++j) {
+                    branch_input[j] = branch_start[j * decimation_factor];
+                }
+                double * target = (p == 0) ? chunk_output : branch_output.data();
+                fir_block(reversed_branches[p].data(), branch_length, branch_input.data(), target, num_kept);
+                if (p > 0) {
+                    for (int m = 0; m < num_kept; ++m) chunk_output[m] += branch_output[m];
+                }
+            }
+            num_outputs += num_kept;
+        }
+        next_output_offset += num_kept * decimation_factor - num_inputs;
+
+        // the newest LM - 1 inputs become the previous inputs of the next chunk
+        std::copy(
+            block_buffer.begin() + num_inputs, block_buffer.begin() + num_inputs + num_previous, block_buffer.begin()
+        );
+        position += num_inputs;
+    }
+    block_buffer.resize(num_previous);
+    return num_outputs;
+}
+
+std::size_t DecimatingFIRFilter::get_max_output_length(std::size_t input_length) const {
+    /*
+     * param input_length: Number of samples in a block
+     * return: Largest number of outputs that apply_filter_block can write for the block (ceil(length / M))
+     */
+    return (input_length + decimation_factor - 1) / decimation_factor;
+}
+
+int DecimatingFIRFilter::get_decimation_factor() const {
+    /*
+     * return: Number of inputs per output (M)
+     */
+    return decimation_factor;
+}
+
+std::vector<double> DecimatingFIRFilter::get_coefficients() const {
+    /*
+     * return: Vector containing the filter coefficients (before the polyphase split)
+     */
+    return b_coefficients;
+}
+
+#endif
@@ -0,0 +1,50 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef DECIMATING_FIR_FILTER_HPP
+#define DECIMATING_FIR_FILTER_HPP
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef FIR_KERNELS_HPP
+#include "../fir_kernels.hpp"
+#endif
+
+#ifndef POLYPHASE_HPP
+#include "../polyphase.hpp"
+#endif
+
+class DecimatingFIRFilter {
+    /* FIR filter followed by downsampling by an integer factor M (keeps outputs 0, M, 2M ...)
+     *
+     * The coefficients are split into M polyphase branches, so only the kept outputs are calculated (1/M of the
+     * work of filtering at the full rate and discarding the rest). Each branch filters every Mth input with the
+     * block kernels.
+     */
+
+    private:
+        int decimation_factor;  // M
+        int branch_length;  // L = ceil(N / M) coefficients per branch
+        std::vector<double> b_coefficients;
+        std::vector<std::vector<double>> reversed_branches;  // polyphase branches (see split_polyphase)
+        std::vector<double> block_buffer;  // LM - 1 previous inputs followed by a chunk of new inputs
+        std::vector<double> branch_input;  // every Mth input of the block buffer (one branch at a time)
+        std::vector<double> branch_output;  // output of one branch (added to the other branches)
+        int next_output_offset;  // position of the next kept output within the next block of inputs
+
+    public:
+        DecimatingFIRFilter(const std::vector<double>& coefficients, int decimation_factor);
+
+        std::size_t apply_filter_block(const double * input, double * output, std::size_t length);
+        void reset();
+
+        std::size_t get_max_output_length(std::size_t input_length) const;
+        int get_decimation_factor() const;
+        std::vector<double> get_coefficients() const;
+};
+
+#endif //DECIMATING_FIR_FILTER_HPP
@@ -0,0 +1,262 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FAST_CONVOLUTION_ENGINE_HPP
+
+#include "FastConvolutionEngine.hpp"
+
+template <typename Sample>
+BasicFastConvolutionEngine<Sample>::BasicFastConvolutionEngine() {
+    /* Empty engine (must be replaced by a configured engine before processing) */
+
+    convolution_mode = direct_form;
+    num_coefficients = 0;
+    fft_size = 0;
+    block_length = 0;
+}
+
+template <typename Sample>
+BasicFastConvolutionEngine<Sample>::BasicFastConvolutionEngine(
+    const std::vector<double>& coefficients,
+    ConvolutionMode convolution_mode,
+    SharedCoefficientSpectrum<Sample> coefficient_spectrum
+) {
+    /* FFT convolution engine constructor
+     *
+     * param coefficients: FIR filter coefficients (impulse response)
+     * param convolution_mode: Either overlap_add or overlap_save
+     * param coefficient_spectrum: FFT of the coefficients from calculate_coefficient_spectrum (calculated if nullptr)
+     */
+
+    if (convolution_mode != overlap_add && convolution_mode != overlap_save) {
+        throw std::runtime_error("FFT convolution must use overlap_add or overlap_save!");
+    }
+    if (coefficients.empty()) {
+        throw std::runtime_error("FFT convolution needs at least 1 coefficient!");
+    }
+
+    this->convolution_mode = convolution_mode;
+    num_coefficients = (int) coefficients.size();
+    fft_size = choose_fft_size(num_coefficients);
+    // each FFT produces fft_size - (num_coefficients - 1) samples without circular aliasing
+    block_length = fft_size - num_coefficients + 1;
+
+    // signals are real so only the non-negative frequency bins are calculated
+    fft_plan = get_shared_plan(fft_size);
+    fft_buffer.assign(fft_size, 0.0);
+    spectrum_buffer.resize(fft_plan->get_num_bins());
+
+    // the coefficient spectrum is only calculated once (copies of a filter share it)
+    if (coefficient_spectrum == nullptr) {
+        coefficient_spectrum = calculate_coefficient_spectrum(coefficients);
+    }
+    else if ((int) coefficient_spectrum->size() != fft_plan->get_num_bins()) {
+        throw std::runtime_error("Coefficient spectrum does not match the FFT size!");
+    }
+    this->coefficient_spectrum = coefficient_spectrum;
+    reset();
+}
+
+template <typename Sample>
+SharedCoefficientSpectrum<Sample> BasicFastConvolutionEngine<Sample>::calculate_coefficient_spectrum(
+    const std::vector<double>& coefficients
+) {
+    /* Calculates the FFT of the zero padded coefficients (coefficients are designed in double precision)
+     *
+     * param coefficients: FIR filter coefficients (impulse response)
+     * return: Spectrum for an engine with these coefficients (FFT size from choose_fft_size)
+     */
+
+    if (coefficients.empty()) {
+        throw std::runtime_error("FFT convolution needs at least 1 coefficient!");
+    }
+
+    std::shared_ptr<const BasicRealFFTPlan<Sample>> plan = get_shared_plan(choose_fft_size((int) coefficients.size()));
+    std::vector<Sample> padded_coefficients(plan->get_size(), 0.0);
+    std::copy(coefficients.begin(), coefficients.end(), padded_coefficients.begin());
+    auto spectrum = std::make_shared<std::vector<std::complex<Sample>>>(plan->get_num_bins());
+    real_fft(padded_coefficients.data(), spectrum->data(), *plan);
+    return spectrum;
+}
+
+template <typename Sample>
+int BasicFastConvolutionEngine<Sample>::choose_fft_size(int num_coefficients) {
+    /* Chooses the power of 2 FFT size with the lowest estimated cost per output sample
+     *
+     * param num_coefficients: Number of FIR coefficients
+     * return: FFT size (at least twice the number of coefficients)
+     */
+
+    int smallest_size = 2;
+    while (smallest_size < 2 * num_coefficients) {
+        smallest_size *= 2;
+    }
+
+    // cost of a forward and inverse FFT is ~ N log2(N), shared between N - M + 1 outputs
+    int best_size = smallest_size;
+    double best_cost = -1.0;
+    for (int size = smallest_size; size <= smallest_size * 16; size *= 2) {
+        double cost = size * (log2(size) + 1.0) / (size - num_coefficients + 1);
+        if (best_cost < 0.0 || cost < best_cost) {
+            best_cost = cost;
+            best_size = size;
+        }
+    }
+    return best_size;
+}
+
+template <typename Sample>
+std::shared_ptr<const BasicRealFFTPlan<Sample>> BasicFastConvolutionEngine<Sample>::get_shared_plan(int fft_size) {
+    /* Finds the FFT plan for a size, creating it the first time the size is used (thread safe)
+     *
+     * Plans are never modified by a transform, so copies of a filter (e.g. one per channel) share their tables
+     * instead of recalculating the twiddle factors.
+     *
+     * param fft_size: Size of the real FFT (a power of 2)
+     * return: The plan (shared with every other engine of this precision and size)
+     */
+
+    static std::mutex plans_mutex;
+    static std::map<int, std::shared_ptr<const BasicRealFFTPlan<Sample>>> plans;
+
+    std::lock_guard<std::mutex> lock(plans_mutex);
+    std::shared_ptr<const BasicRealFFTPlan<Sample>>& plan = plans[fft_size];
+    if (plan == nullptr) {
+        plan = std::make_shared<const BasicRealFFTPlan<Sample>>(fft_size);
+    }
+    return plan;
+}
+
+template <typename Sample>
+void BasicFastConvolutionEngine<Sample>::reset() {
+    /* Clears the stored history (as if all previous inputs were 0) */
+
+    overlap.assign(num_coefficients > 0 ? num_coefficients - 1 : 0, 0.0);
+}
+
+template <typename Sample>
+void BasicFastConvolutionEngine<Sample>::process(const Sample * input, Sample * output, std::size_t length) {
+    /* Filters a block of samples (any length, outputs are not delayed)
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     * param length: Number of samples in the block
+     */
+
+    if (fft_size == 0) {
+        throw std::runtime_error("FFT convolution engine has not been configured!");
+    }
+
+    // the signal is split into blocks that each fit into a single FFT
+    std::size_t position = 0;
+    while (position < length) {
+        int chunk_length = (int) std::min<std::size_t>(block_length, length - position);
+        if (convolution_mode == overlap_add) {
+            process_overlap_add(input + position, output + position, chunk_length);
+        }
+        else {
+            process_overlap_save(input + position, output + position, chunk_length);
+        }
+        position += chunk_length;
+    }
+}
+
+template <typename Sample>
+void BasicFastConvolutionEngine<Sample>::convolve_fft_buffer() {
+    /* Circularly convolves the FFT buffer with the coefficients (in place) */
+
+    real_fft(fft_buffer.data(), spectrum_buffer.data(), *fft_plan);
+    for (int i = 0; i < fft_plan->get_num_bins(); ++i) {
+        const std::complex<Sample> & a = spectrum_buffer[i];
+        const std::complex<Sample> & b = (*coefficient_spectrum)[i];
+        // complex multiply is written out to avoid the slow NaN handling of std::complex
+        spectrum_buffer[i] = std::complex<Sample>(
+            a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()
+        );
+    }
+    inv_real_fft(spectrum_buffer.data(), fft_buffer.data(), *fft_plan);
+}
+
+template <typename Sample>
+void BasicFastConvolutionEngine<Sample>::process_overlap_add(const Sample * input, Sample * output, int length) {
+    /* Convolves a zero padded block and adds the tail left over from the previous block */
+
+    int overlap_length = num_coefficients - 1;
+
+    std::fill(fft_buffer.begin(), fft_buffer.end(), 0.0);
+    for (int i = 0; i < length; ++i) {
+        fft_buffer[i] = input[i];
+    }
+    convolve_fft_buffer();
+
+    // outputs = start of the convolution + tail of the previous convolution
+    for (int i = 0; i < length; ++i) {
+        output[i] = fft_buffer[i] + (i < overlap_length ? overlap[i] : 0);
+    }
+    // the remaining convolution (and any unused previous tail) becomes the new tail
+    for (int i = 0; i < overlap_length; ++i) {
+        Sample previous_tail = (i + length < overlap_length) ? overlap[i + length] : 0;
+        overlap[i] = fft_buffer[i + length] + previous_tail;
+    }
+}
+
+template <typename Sample>
+void BasicFastConvolutionEngine<Sample>::process_overlap_save(const Sample * input, Sample * output, int length) {
+    /* Convolves the previous inputs followed by the new block, keeping only the un-aliased outputs */
+
+    int overlap_length = num_coefficients - 1;
+
+    std::fill(fft_buffer.begin(), fft_buffer.end(), 0.0);
+    for (int i = 0; i < overlap_length; ++i) {
+        fft_buffer[i] = overlap[i];
+    }
+    for (int i = 0; i < length; ++i) {
+        fft_buffer[overlap_length + i] = input[i];
+    }
+
+    // the newest inputs are saved for the next block before the buffer is transformed
+    if (length >= overlap_length) {
+        std::copy(input + length - overlap_length, input + length, overlap.begin());
+    }
+    else {
+        std::copy(overlap.begin() + length, overlap.end(), overlap.begin());
+        std::copy(input, input + length, overlap.end() - length);
+    }
+
+    convolve_fft_buffer();
+
+    // the first num_coefficients - 1 outputs are corrupted by circular convolution and are discarded
+    for (int i = 0; i < length; ++i) {
+        output[i] = fft_buffer[overlap_length + i];
+    }
+}
+
+template <typename Sample>
+int BasicFastConvolutionEngine<Sample>::get_fft_size() const {
+    /*
+     * return: Size of the FFTs used for convolution
+     */
+    return fft_size;
+}
+
+template <typename Sample>
+int BasicFastConvolutionEngine<Sample>::get_block_length() const {
+    /*
+     * return: Number of new samples processed per FFT
+     */
+    return block_length;
+}
+
+template <typename Sample>
+SharedCoefficientSpectrum<Sample> BasicFastConvolutionEngine<Sample>::get_coefficient_spectrum() const {
+    /*
+     * return: FFT of the zero padded coefficients (nullptr for an empty engine)
+     */
+    return coefficient_spectrum;
+}
+
+template class BasicFastConvolutionEngine<double>;
+template class BasicFastConvolutionEngine<float>;
+
+#endif
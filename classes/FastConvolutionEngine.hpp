@@ -0,0 +1,78 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FAST_CONVOLUTION_ENGINE_HPP
+#define FAST_CONVOLUTION_ENGINE_HPP
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <map>
+#include <mutex>
+
+#ifndef FFT_HPP
+#include "../fft.hpp"
+#endif
+
+/* Ways of convolving a signal with FIR coefficients */
+enum ConvolutionMode { direct_form, overlap_add, overlap_save };
+
+// number of FIR coefficients at which FFT convolution becomes faster than the (SIMD) direct form
+const int fft_convolution_threshold = 256;
+
+// FFT of zero padded FIR coefficients (read only, so engines with the same coefficients can share one copy)
+template <typename Sample>
+using SharedCoefficientSpectrum = std::shared_ptr<const std::vector<std::complex<Sample>>>;
+
+template <typename Sample>
+class BasicFastConvolutionEngine {
+    /* Frequency domain (FFT based) FIR convolution using overlap-add or overlap-save
+     *
+     * Sample is the precision of the signal and the FFTs (float or double).
+     */
+
+    private:
+        ConvolutionMode convolution_mode;
+        int num_coefficients;
+        int fft_size;
+        int block_length;  // number of new samples processed per FFT
+        std::shared_ptr<const BasicRealFFTPlan<Sample>> fft_plan;  // shared by every engine with the same FFT size
+        SharedCoefficientSpectrum<Sample> coefficient_spectrum;
+        std::vector<std::complex<Sample>> spectrum_buffer;
+        std::vector<Sample> fft_buffer;  // time domain block that is convolved in place
+        // overlap-add: tail of the previous convolution, overlap-save: previous inputs (oldest first)
+        std::vector<Sample> overlap;
+
+        void convolve_fft_buffer();
+        void process_overlap_add(const Sample * input, Sample * output, int length);
+        void process_overlap_save(const Sample * input, Sample * output, int length);
+
+    public:
+        BasicFastConvolutionEngine();
+        BasicFastConvolutionEngine(
+            const std::vector<double>& coefficients,
+            ConvolutionMode convolution_mode,
+            SharedCoefficientSpectrum<Sample> coefficient_spectrum = nullptr
+        );
+
+        static int choose_fft_size(int num_coefficients);
+        static std::shared_ptr<const BasicRealFFTPlan<Sample>> get_shared_plan(int fft_size);
+        static SharedCoefficientSpectrum<Sample> calculate_coefficient_spectrum(const std::vector<double>& coefficients);
+
+        void process(const Sample * input, Sample * output, std::size_t length);
+        void reset();
+
+        int get_fft_size() const;
+        int get_block_length() const;
+        SharedCoefficientSpectrum<Sample> get_coefficient_spectrum() const;
+};
+
+// engines are instantiated for double and float (FastConvolutionEngine.cpp)
+typedef BasicFastConvolutionEngine<double> FastConvolutionEngine;
+typedef BasicFastConvolutionEngine<float> FloatFastConvolutionEngine;
+
+#endif //FAST_CONVOLUTION_ENGINE_HPP
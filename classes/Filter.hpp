@@ -6,10 +6,15 @@
 #define FILTER_HPP
 
 #include <vector>
+#include <cstddef>
+#include <memory>
 
 /* Types of filters */
 enum FilterType { low_pass, high_pass, band_pass, band_stop };
 
+/* Precision that a signal is filtered in (single precision halves the memory used per sample) */
+enum SamplePrecision { double_precision, single_precision };
+
 class Filter {
     /* Abstract filter class */
 
@@ -24,10 +29,17 @@ class Filter {
         ) = 0;
 
     public:
+        virtual ~Filter() = default;
+
         virtual void generate_coefficients(
             FilterType filter_type, const std::vector<double>& cut_off_frequencies
         ) = 0;
         virtual double apply_filter(double sample) = 0;
+        // filters a contiguous block of samples into a caller-provided output buffer
+        virtual void apply_filter_block(const double * input, double * output, std::size_t length) = 0;
+        virtual void apply_filter_block(const float * input, float * output, std::size_t length) = 0;
+        // copies the coefficients into a new filter of the same type with a cleared state
+        virtual std::unique_ptr<Filter> clone() const = 0;
 };
 
 #endif //FILTER_HPP
@@ -23,14 +23,67 @@ FiniteImpulseResponseFilter::FiniteImpulseResponseFilter(
 
     this->sampling_frequency = sampling_frequency;
     this->num_taps = num_taps;
+    // direct form is used until FFT convolution is requested
+    convolution_mode = direct_form;
 
     // generates b coefficients
     generate_coefficients(filter_type, cut_off_frequencies);
+}
+
+FiniteImpulseResponseFilter::FiniteImpulseResponseFilter(
+    double sampling_frequency, const std::vector<double>& coefficients
+) {
+    /* FIR Filter constructor for coefficients that have already been designed (e.g. by the CoefficientCache)
+     *
+     * param sampling_frequency: Frequency at which the data (to be filtered) was sampled
+     * param coefficients: Filter coefficients (an odd number, (2 * num_taps) + 1)
+     */
 
-    // initialises an empty vector of 0s with the same size as number of coefficients
-    for (int i = 0; i < b_coefficients.size(); ++i) {
-        signal_input_history.push_back(0.0);
+    if (coefficients.size() % 2 == 0) {
+        throw std::invalid_argument("An FIR filter must have an odd number of coefficients!");
     }
+
+    this->sampling_frequency = sampling_frequency;
+    num_taps = (int) coefficients.size() / 2;
+    b_coefficients = coefficients;
+
+    convolution_mode = direct_form;
+    reset_filter_state();
+}
+
+void FiniteImpulseResponseFilter::reset_filter_state() {
+    /* Clears the input history and prepares the coefficients for the current convolution mode */
+
+    // initialises a ring buffer of 0s with twice the number of coefficients (mirrored halves)
+    signal_input_history.assign(2 * b_coefficients.size(), 0.0);
+    history_index = 0;
+
+    reversed_coefficients.resize(b_coefficients.size());
+    reverse_copy(b_coefficients.begin(), b_coefficients.end(), reversed_coefficients.begin());
+    // rounding keeps the symmetry of the coefficients
+    float_reversed_coefficients.assign(reversed_coefficients.begin(), reversed_coefficients.end());
+    coefficient_symmetry = detect_symmetry(b_coefficients.data(), (int) b_coefficients.size());
+
+    if (convolution_mode == direct_form) {
+        fast_convolution_engine = FastConvolutionEngine();
+    }
+    else {
+        fast_convolution_engine = FastConvolutionEngine(b_coefficients, convolution_mode, coefficient_spectrum);
+        coefficient_spectrum = fast_convolution_engine.get_coefficient_spectrum();
+    }
+    float_fast_convolution_engine = FloatFastConvolutionEngine();
+}
+
+void FiniteImpulseResponseFilter::coefficients_changed() {
+    /* Prepares the filter for new b coefficients (clears the input history)
+     *
+     * The block kernels and FFT engines use copies of the coefficients, so they are all made again. Spectra of the
+     * previous coefficients (which may be shared with other filters) are dropped rather than modified.
+     */
+
+    coefficient_spectrum = nullptr;
+    float_coefficient_spectrum = nullptr;
+    reset_filter_state();
 }
 
 void FiniteImpulseResponseFilter::calculate_low_pass_coefficents(double cut_off_frequency) {
@@ -175,6 +228,7 @@ void FiniteImpulseResponseFilter::generate_coefficients(
     /* The coefficients are calculated depending on the type of filter specified
      *
      * param filter_type: Type of filter to use (low_pass, high_pass or band_pass)
+     * param cut_off_frequencies: Cut off frequencies of the filter (1 value for low pass and high pass, 2 otherwise)
      */
 
     if (filter_type == low_pass) {
@@ -194,6 +248,7 @@ void FiniteImpulseResponseFilter::generate_coefficients(
              << "Valid filter types: low_pass, high_pass, band_pass and band_stop.";
         exit(EXIT_FAILURE);
     }
+    coefficients_changed();
 }
 
 void FiniteImpulseResponseFilter::apply_window(WindowFunction window_function) {
@@ -203,7 +258,7 @@ void FiniteImpulseResponseFilter::apply_window(WindowFunction window_function) {
      */
 
     int N = (2 * num_taps) + 1;
-    std::vector<double> win_function;
+    std::vector<double> win_function(N);
 
     // rectangular window function does nothing to the coefficients (default)
     if (window_function == rectangular) {
@@ -226,7 +281,7 @@ void FiniteImpulseResponseFilter::apply_window(WindowFunction window_function) {
     else if (window_function == blackman) {
         for (int i = 0; i < N; ++i) {
             double temp = (2.0 * M_PI * i) / (N - 1);
-            win_function[i] = 0.42 - 0.5 * cos(temp) + 0.08 * cos(temp);
+            win_function[i] = 0.42 - 0.5 * cos(temp) + 0.08 * cos(2.0 * temp);
         }
     }
     else {
@@ -239,69 +294,191 @@ void FiniteImpulseResponseFilter::apply_window(WindowFunction window_function) {
     for (int i = 0; i < N; ++i) {
         b_coefficients[i] = win_function[i] * b_coefficients[i];
     }
+    coefficients_changed();
 }
 
-void fft(std::valarray<std::complex<double>> & data) {
-    unsigned int N = data.size();
-    if (N <= 1) return;
-
-    // separates the even and odd indices
-    std::valarray<std::complex<double>> even_data = data[std::slice(0, N / 2, 2)];
-    std::valarray<std::complex<double>> odd_data = data[std::slice(1, N / 2, 2)];
-    // recursively splits the data until pairs are left
-    fft(even_data);
-    fft(odd_data);
-
-    for (int i = 0; i < N / 2; ++i) {
-        std::complex<double> t = std::polar(1.0, -2 * M_PI * i / N) * odd_data[i];
-        data[i] = even_data[i] + t;
-        data[i + N / 2] = even_data[i] - t;
+double FiniteImpulseResponseFilter::apply_filter(double sample) {
+    /* Generates output for FIR filter (filters inputted sample)
+     *
+     * param sample: Newly inputted sample of data to filter
+     * return: Filtered version of the inputted sample
+     */
+
+    if (convolution_mode != direct_form) {
+        // FFT convolution is inefficient one sample at a time (apply_filter_block should be used instead)
+        double result;
+        fast_convolution_engine.process(&sample, &result, 1);
+        return result;
     }
+    return apply_direct_form(sample);
 }
 
-void inv_fft(std::valarray<std::complex<double>> & data) {
-    // reverses sign of imaginary part (conjugation)
-    data = data.apply(std::conj);
+void FiniteImpulseResponseFilter::push_input(double sample) {
+    /* Adds a sample to the input history (ring buffer) */
 
-    // applies fft to data
-    fft(data);
+    int num_coefficients = (int) b_coefficients.size();
 
-    // reverses sign of imaginary part again (conjugation)
-    data = data.apply(std::conj);
+    // steps backwards through the ring buffer so that x[n - k] is found at history_index + k
+    history_index = (history_index == 0) ? num_coefficients - 1 : history_index - 1;
+    // the sample is written to both halves so the window never wraps around
+    signal_input_history[history_index] = sample;
+    signal_input_history[history_index + num_coefficients] = sample;
 }
 
-double FiniteImpulseResponseFilter::apply_filter(double sample) {
-    /* Generates output for FIR filter (filters inputted sample)
+double FiniteImpulseResponseFilter::apply_direct_form(double sample) {
+    /* Generates output for FIR filter using direct form convolution
      *
      * param sample: Newly inputted sample of data to filter
      * return: Filtered version of the inputted sample
      */
 
-    // updates vector before calculation so inputted sample is used
-    signal_input_history.push_back(sample);
-    signal_input_history.erase(signal_input_history.begin());
-
-//    // converts double vector to complex double valarray
-//    std::valarray<std::complex<double>> complex_coeff(b_coefficients.size());
-//    std::valarray<std::complex<double>> complex_input_history(b_coefficients.size());
-//    for (int i = 0; i < b_coefficients.size(); ++i) {
-//        complex_coeff[i] = (std::complex<double>) b_coefficients[i];
-//        complex_input_history[i] = (std::complex<double>) signal_input_history[i];
-//    }
-//    fft(complex_coeff);
-//    fft(complex_input_history);
-//    std::valarray<std::complex<double>> result_array = complex_coeff * complex_input_history;
-//    inv_fft(result_array);
-//    std::complex<double> result_value = result_array.sum();
-//    std::cout << result_value << std::endl;
-
-    // performs sum{k=0->N}(b_k * x[n - k])
-    double result = 0.0;
-    int final_index = (int) signal_input_history.size() - 1;
-    for (int i = 0; i < b_coefficients.size(); ++i) {
-        result += b_coefficients[i] * signal_input_history[final_index - i];
+    push_input(sample);
+
+    // performs sum{k=0->N}(b_k * x[n - k]) using the SIMD kernel selected for this CPU
+    int num_coefficients = (int) b_coefficients.size();
+    return dot_product(b_coefficients.data(), &signal_input_history[history_index], num_coefficients);
+}
+
+template <typename Sample>
+void FiniteImpulseResponseFilter::apply_direct_form_block(
+    const Sample * input,
+    Sample * output,
+    std::size_t length,
+    const std::vector<Sample>& block_coefficients,
+    std::vector<Sample>& buffer
+) {
+    /* Filters a block using direct form convolution (SIMD kernels calculate neighbouring outputs together)
+     *
+     * param block_coefficients: reversed_coefficients in the precision of the block
+     * param buffer: block_buffer in the precision of the block
+     */
+
+    const int chunk_length = 4096;  // bounds the size of the block buffer
+    int num_coefficients = (int) b_coefficients.size();
+    int num_previous = num_coefficients - 1;
+    if (buffer.size() < num_previous + chunk_length) {
+        buffer.resize(num_previous + chunk_length);
+    }
+
+    std::size_t position = 0;
+    while (position < length) {
+        int num_inputs = (int) std::min<std::size_t>(chunk_length, length - position);
+
+        // the previous inputs (x[n - N + 1] ... x[n - 1]) come first, followed by the new inputs
+        for (int k = 0; k < num_previous; ++k) {
+            buffer[num_previous - 1 - k] = (Sample) signal_input_history[history_index + k];
+        }
+        std::copy(input + position, input + position + num_inputs, buffer.begin() + num_previous);
+
+        fir_block_folded(
+            block_coefficients.data(), num_coefficients, coefficient_symmetry,
+            buffer.data(), output + position, num_inputs
+        );
+
+        // only the newest inputs are kept in the ring buffer (apply_filter continues where the block finished)
+        for (int i = std::max(0, num_inputs - num_coefficients); i < num_inputs; ++i) {
+            push_input(input[position + i]);
+        }
+        position += num_inputs;
+    }
+}
+
+void FiniteImpulseResponseFilter::apply_filter_block(
+    const double * input, double * output, std::size_t length
+) {
+    /* Filters a block of samples (same result as calling apply_filter on each sample)
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     * param length: Number of samples in the block
+     */
+
+    if (convolution_mode != direct_form) {
+        fast_convolution_engine.process(input, output, length);
+        return;
     }
-    return result;
+    apply_direct_form_block(input, output, length, reversed_coefficients, block_buffer);
+}
+
+void FiniteImpulseResponseFilter::apply_filter_block(
+    const float * input, float * output, std::size_t length
+) {
+    /* Filters a block of single precision samples (float kernels handle twice as many samples per instruction)
+     *
+     * Direct form shares its input history with the double precision functions, but FFT convolution keeps a
+     * separate history for each precision.
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     * param length: Number of samples in the block
+     */
+
+    if (convolution_mode != direct_form) {
+        if (float_fast_convolution_engine.get_fft_size() == 0) {
+            float_fast_convolution_engine = FloatFastConvolutionEngine(
+                b_coefficients, convolution_mode, float_coefficient_spectrum
+            );
+            float_coefficient_spectrum = float_fast_convolution_engine.get_coefficient_spectrum();
+        }
+        float_fast_convolution_engine.process(input, output, length);
+        return;
+    }
+    apply_direct_form_block(input, output, length, float_reversed_coefficients, float_block_buffer);
+}
+
+std::unique_ptr<Filter> FiniteImpulseResponseFilter::clone() const {
+    /* Copies the filter (coefficients and convolution mode) with an empty input history
+     *
+     * return: The copied filter
+     */
+
+    std::unique_ptr<FiniteImpulseResponseFilter> filter(new FiniteImpulseResponseFilter(*this));
+    filter->reset_filter_state();
+    return filter;
+}
+
+void FiniteImpulseResponseFilter::set_convolution_mode(ConvolutionMode convolution_mode) {
+    /* Chooses how the filter is applied (resets the filter's input history)
+     *
+     * param convolution_mode: direct_form, overlap_add or overlap_save (FFT based, faster for many taps)
+     */
+
+    this->convolution_mode = convolution_mode;
+    reset_filter_state();
+}
+
+void FiniteImpulseResponseFilter::set_coefficient_spectrum(SharedCoefficientSpectrum<double> coefficient_spectrum) {
+    /* Uses an FFT of the coefficients that has already been calculated (resets the filter's input history)
+     *
+     * param coefficient_spectrum: FastConvolutionEngine::calculate_coefficient_spectrum(get_coefficients())
+     */
+
+    this->coefficient_spectrum = coefficient_spectrum;
+    reset_filter_state();
+}
+
+void FiniteImpulseResponseFilter::set_coefficient_spectrum(SharedCoefficientSpectrum<float> coefficient_spectrum) {
+    /* Uses an FFT of the coefficients for single precision blocks (resets the filter's input history)
+     *
+     * param coefficient_spectrum: FloatFastConvolutionEngine::calculate_coefficient_spectrum(get_coefficients())
+     */
+
+    float_coefficient_spectrum = coefficient_spectrum;
+    reset_filter_state();
+}
+
+ConvolutionMode FiniteImpulseResponseFilter::get_convolution_mode() {
+    /*
+     * return: How the filter is currently applied (direct_form, overlap_add or overlap_save)
+     */
+    return convolution_mode;
+}
+
+CoefficientSymmetry FiniteImpulseResponseFilter::get_coefficient_symmetry() {
+    /*
+     * return: Symmetry of the coefficients (symmetric and antisymmetric filters use the folded kernels)
+     */
+    return coefficient_symmetry;
 }
 
 std::vector<double> FiniteImpulseResponseFilter::get_coefficients() {
@@ -10,13 +10,20 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <valarray>
-#include <complex>
+#include <stdexcept>
 
 #ifndef FILTER_HPP
 #include "Filter.hpp"
 #endif
 
+#ifndef FIR_KERNELS_HPP
+#include "../fir_kernels.hpp"
+#endif
+
+#ifndef FAST_CONVOLUTION_ENGINE_HPP
+#include "FastConvolutionEngine.hpp"
+#endif
+
 enum WindowFunction { rectangular, hanning, hamming, blackman };
 
 class FiniteImpulseResponseFilter: public Filter {
@@ -24,9 +31,35 @@ class FiniteImpulseResponseFilter: public Filter {
 
     private:
         std::vector<double> b_coefficients;
-        std::vector<double> signal_input_history;  // previous inputs
+        std::vector<double> reversed_coefficients;  // b_coefficients in reverse order (used by the block kernels)
+        std::vector<float> float_reversed_coefficients;  // reversed_coefficients rounded for the float kernels
+        CoefficientSymmetry coefficient_symmetry;  // linear phase filters use the folded block kernels
+        // previous inputs, stored twice (mirrored) so the newest N inputs are always contiguous
+        std::vector<double> signal_input_history;
+        int history_index;  // position of the newest input within the first half of the history
+        std::vector<double> block_buffer;  // previous inputs followed by a block of new inputs (in time order)
+        std::vector<float> float_block_buffer;  // block_buffer for single precision blocks
         double sampling_frequency;
         int num_taps;
+        ConvolutionMode convolution_mode;
+        FastConvolutionEngine fast_convolution_engine;  // only used when convolution_mode != direct_form
+        FloatFastConvolutionEngine float_fast_convolution_engine;  // created by the first single precision block
+        // FFTs of the coefficients (calculated by the first engine, then shared by copies of the filter)
+        SharedCoefficientSpectrum<double> coefficient_spectrum;
+        SharedCoefficientSpectrum<float> float_coefficient_spectrum;
+
+        void reset_filter_state();
+        void coefficients_changed();
+        void push_input(double sample);
+        double apply_direct_form(double sample);
+        template <typename Sample>
+        void apply_direct_form_block(
+            const Sample * input,
+            Sample * output,
+            std::size_t length,
+            const std::vector<Sample>& block_coefficients,
+            std::vector<Sample>& buffer
+        );
 
         void calculate_low_pass_coefficents(double cut_off_frequency) override;
         void calculate_high_pass_coefficents(double cut_off_frequency) override;
@@ -44,6 +77,7 @@ class FiniteImpulseResponseFilter: public Filter {
             const std::vector<double>& cut_off_frequencies,
             int num_taps
         );
+        FiniteImpulseResponseFilter(double sampling_frequency, const std::vector<double>& coefficients);
 
         void generate_coefficients(
             FilterType filter_type, const std::vector<double>& cut_off_frequencies
@@ -52,6 +86,15 @@ class FiniteImpulseResponseFilter: public Filter {
         void apply_window(WindowFunction window_function = rectangular);
 
         double apply_filter(double sample) override;
+        void apply_filter_block(const double * input, double * output, std::size_t length) override;
+        void apply_filter_block(const float * input, float * output, std::size_t length) override;
+        std::unique_ptr<Filter> clone() const override;
+
+        void set_convolution_mode(ConvolutionMode convolution_mode);
+        void set_coefficient_spectrum(SharedCoefficientSpectrum<double> coefficient_spectrum);
+        void set_coefficient_spectrum(SharedCoefficientSpectrum<float> coefficient_spectrum);
+        ConvolutionMode get_convolution_mode();
+        CoefficientSymmetry get_coefficient_symmetry();
 
         std::vector<double> get_coefficients();
 };
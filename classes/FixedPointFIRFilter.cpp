@@ -0,0 +1,127 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FIXED_POINT_FIR_FILTER_HPP
+
+#include "FixedPointFIRFilter.hpp"
+
+FixedPointFIRFilter::FixedPointFIRFilter(const std::vector<double>& coefficients) {
+    /* Fixed point FIR filter constructor
+     *
+     * param coefficients: Filter coefficients (e.g. FiniteImpulseResponseFilter::get_coefficients())
+     */
+
+    if (coefficients.empty()) {
+        throw std::invalid_argument("A fixed point FIR filter needs at least 1 coefficient!");
+    }
+
+    double largest = 0.0;
+    for (double coefficient : coefficients) {
+        largest = std::max(largest, std::fabs(coefficient));
+    }
+    // uses as many fraction bits as possible (15 for Q15) while every coefficient still fits in 16 bits
+    int fraction_bits = 15;
+    while (fraction_bits > 0 && std::lround(largest * (1 << fraction_bits)) > SHRT_MAX) {
+        --fraction_bits;
+    }
+    if (std::lround(largest * (1 << fraction_bits)) > SHRT_MAX) {
+        throw std::invalid_argument("FIR coefficients are too large for a fixed point filter!");
+    }
+
+    std::vector<signed short> reversed_coefficients(coefficients.size());
+    for (std::size_t i = 0; i < coefficients.size(); ++i) {
+        reversed_coefficients[coefficients.size() - 1 - i] =
+            (signed short) std::lround(coefficients[i] * (1 << fraction_bits));
+    }
+    q15_coefficients = prepare_q15_coefficients(reversed_coefficients, fraction_bits);
+
+    reset();
+}
+
+void FixedPointFIRFilter::reset() {
+    /* Clears the input history (as if all previous inputs were 0) */
+
+    block_buffer.assign(q15_coefficients.reversed_coefficients.size() - 1, 0);
+}
+
+void FixedPointFIRFilter::apply_filter_block(const signed short * input, signed short * output, std::size_t length) {
+    /* Filters a block of 16 bit samples (continues from the previous block)
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     * param length: Number of samples in the block
+     */
+
+    const int chunk_length = 4096;  // bounds the size of the block buffer
+    int num_coefficients = (int) q15_coefficients.reversed_coefficients.size();
+    int num_previous = num_coefficients - 1;
+    block_buffer.resize(num_previous + chunk_length);
+
+    std::size_t position = 0;
+    while (position < length) {
+        int num_inputs = (int) std::min<std::size_t>(chunk_length, length - position);
+        // the previous inputs are already at the start of the buffer
+        std::copy(input + position, input + position + num_inputs, block_buffer.begin() + num_previous);
+
+        fir_block_q15(q15_coefficients, block_buffer.data(), output + position, num_inputs);
+
+        // the newest N - 1 inputs become the previous inputs of the next block
+        std::copy(
+            block_buffer.begin() + num_inputs, block_buffer.begin() + num_inputs + num_previous, block_buffer.begin()
+        );
+        position += num_inputs;
+    }
+    block_buffer.resize(num_previous);
+}
+
+std::vector<double> FixedPointFIRFilter::get_coefficients() const {
+    /*
+     * return: Coefficients actually used by the filter (after rounding to fixed point)
+     */
+
+    const std::vector<signed short>& reversed_coefficients = q15_coefficients.reversed_coefficients;
+    std::vector<double> coefficients(reversed_coefficients.size());
+    for (std::size_t i = 0; i < coefficients.size(); ++i) {
+        coefficients[i] = reversed_coefficients[coefficients.size() - 1 - i] / (double) (1 << q15_coefficients.shift);
+    }
+    return coefficients;
+}
+
+int FixedPointFIRFilter::get_fraction_bits() const {
+    /*
+     * return: Number of fraction bits of the coefficients (15 for Q15)
+     */
+    return q15_coefficients.shift;
+}
+
+bool FixedPointFIRFilter::uses_wide_accumulator() const {
+    /*
+     * return: True if groups of products are summed in 64 bits (a 32 bit sum could overflow)
+     */
+    return q15_coefficients.group_ends.size() > 1;
+}
+
+std::vector<std::vector<signed short>> apply_fixed_point_filter(
+    const FixedPointFIRFilter& filter, const std::vector<std::vector<signed short>>& data
+) {
+    /* Filters every channel of 16 bit PCM data (e.g. WavFile::data) with its own copy of the filter
+     *
+     * param filter: Filter to copy for each channel (its input history is cleared first)
+     * param data: Samples to filter (one vector per channel)
+     * return: Filtered samples (one vector per channel)
+     */
+
+    std::vector<std::vector<signed short>> filtered_data;
+    filtered_data.reserve(data.size());
+    for (const std::vector<signed short>& channel : data) {
+        FixedPointFIRFilter channel_filter = filter;
+        channel_filter.reset();
+        std::vector<signed short> filtered_channel(channel.size());
+        channel_filter.apply_filter_block(channel.data(), filtered_channel.data(), channel.size());
+        filtered_data.push_back(std::move(filtered_channel));
+    }
+    return filtered_data;
+}
+
+#endif
@@ -0,0 +1,46 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FIXED_POINT_FIR_FILTER_HPP
+#define FIXED_POINT_FIR_FILTER_HPP
+
+#include <vector>
+#include <cmath>
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef FIR_KERNELS_HPP
+#include "../fir_kernels.hpp"
+#endif
+
+class FixedPointFIRFilter {
+    /* FIR filter for 16 bit PCM samples using fixed point (Q15) coefficients
+     *
+     * Samples are filtered as integers (no conversion to double and back). Coefficients are rounded to Q15
+     * (15 fraction bits), or fewer fraction bits if a coefficient is outside -1 to 1. Products are summed in
+     * 32 bits with pmaddwd when the sum can't overflow (and in 64 bits otherwise), then rounded and saturated.
+     */
+
+    private:
+        Q15Coefficients q15_coefficients;  // fixed point coefficients (value / 2^shift) prepared for fir_block_q15
+        std::vector<signed short> block_buffer;  // N - 1 previous inputs followed by a block of new inputs
+
+    public:
+        explicit FixedPointFIRFilter(const std::vector<double>& coefficients);
+
+        void apply_filter_block(const signed short * input, signed short * output, std::size_t length);
+        void reset();
+
+        std::vector<double> get_coefficients() const;
+        int get_fraction_bits() const;
+        bool uses_wide_accumulator() const;
+};
+
+std::vector<std::vector<signed short>> apply_fixed_point_filter(
+    const FixedPointFIRFilter& filter, const std::vector<std::vector<signed short>>& data
+);
+
+#endif //FIXED_POINT_FIR_FILTER_HPP
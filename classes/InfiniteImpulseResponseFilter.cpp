@@ -5,30 +5,62 @@
 #ifndef IIR_FILTER_HPP
 #include "InfiniteImpulseResponseFilter.hpp"
 
+#ifndef IIR_DESIGN_HPP
+#include "../iir_design.hpp"
+#endif
+
 InfiniteImpulseResponseFilter::InfiniteImpulseResponseFilter(
     FilterType filter_type,
     double sampling_frequency,
     const std::vector<double> &cut_off_frequencies,
-    int filter_order
+    int filter_order,
+    IIRDesign design,
+    double passband_ripple,
+    double stopband_attenuation
 ) {
     /* IIR Filter constructor
      *
-     * param filter_type: Type of filter to use (low_pass, high_pass or band_pass)
-     * param b_coefficients: Vector of b coefficients used to generate an output
-     * param a_coefficients: Vector of a coefficients used to generate an output
+     * param filter_type: Type of filter to use (low_pass, high_pass, band_pass or band_stop)
+     * param sampling_frequency: Frequency at which the data (to be filtered) was sampled
+     * param cut_off_frequencies: Cut off frequencies of the filter (1 value for low pass
+     *     and high pass, and 2 values for band pass and band stop)
+     * param filter_order: Order of the analog prototype (band pass and band stop filters have
+     *     2 * filter_order poles)
+     * param design: Analog prototype (butterworth, chebyshev_1, chebyshev_2 or elliptic)
+     * param passband_ripple: Maximum pass band ripple in dB (chebyshev_1 and elliptic)
+     * param stopband_attenuation: Minimum stop band attenuation in dB (chebyshev_2 and elliptic)
+     *
+     * Cut off frequencies are the -3 dB points for butterworth, the pass band edges for chebyshev_1
+     * and elliptic, and the stop band edges for chebyshev_2.
      */
 
     this->sampling_frequency = sampling_frequency;
     this->filter_order = filter_order;
+    this->design = design;
+    this->passband_ripple = passband_ripple;
+    this->stopband_attenuation = stopband_attenuation;
 
-    // fills previous input vectors with 0s to have the same size as b_coefficients
-    for (int i = 0; i < b_coefficients.size(); ++i) {
-        signal_input_history.push_back(0.0);
-    }
-    // fills previous output vectors with 0s to have the same size as a_coefficients
-    for (int i = 0; i < a_coefficients.size(); ++i) {
-        signal_output_history.push_back(0.0);
-    }
+    // generates the second order sections
+    generate_coefficients(filter_type, cut_off_frequencies);
+    reset();
+}
+
+InfiniteImpulseResponseFilter::InfiniteImpulseResponseFilter(
+    const std::vector<SecondOrderSection>& sections, double sampling_frequency
+) {
+    /* IIR Filter constructor using already designed second order sections
+     *
+     * param sections: Second order sections to cascade (the delays are cleared)
+     * param sampling_frequency: Frequency at which the data (to be filtered) was sampled
+     */
+
+    this->sections = sections;
+    this->sampling_frequency = sampling_frequency;
+    this->filter_order = 2 * (int) sections.size();
+    this->design = butterworth;
+    this->passband_ripple = 0.0;
+    this->stopband_attenuation = 0.0;
+    reset();
 }
 
 void InfiniteImpulseResponseFilter::generate_coefficients(
@@ -62,52 +94,162 @@ double InfiniteImpulseResponseFilter::apply_filter(double sample) {
     /* Generates output for IIR filter
      *
      * param sample: Newly inputted sample of data to filter
+     * return: Filtered version of the inputted sample
      */
 
-    // updates input history vector before calculation so inputted sample is used
-    signal_input_history.push_back(sample);
-    signal_input_history.erase(signal_input_history.begin());
+    // the output of each section is the input of the next
+    double result = sample;
+    for (SecondOrderSection & section : sections) {
+        // transposed direct form II (2 delays per section)
+        double section_input = result;
+        result = section.b0 * section_input + section.state_1;
+        section.state_1 = section.b1 * section_input - section.a1 * result + section.state_2;
+        section.state_2 = section.b2 * section_input - section.a2 * result;
+    }
+    return result;
+}
+
+template <typename Sample>
+void InfiniteImpulseResponseFilter::apply_sections(const Sample * input, Sample * output, std::size_t length) {
+    /* Runs a block through every section (samples are stored as Sample, the sections always use doubles) */
 
-    // performs sum{k=0->N}(b_k * x[n - k]) - sum{k=1->M}(a_k * y[n - k])
-    double result = 0.0;
-    for (int i = 0; i < b_coefficients.size(); ++i) {
-        result += (b_coefficients[i] * signal_input_history[signal_input_history.size() - 1 - i]);
+    if (output != input) {
+        std::copy(input, input + length, output);
     }
-    // new loop is done because sizes of a_coefficients and b_coefficients may not be equal
-    for (int i = 0; i < a_coefficients.size(); ++i) {
-        result -= (a_coefficients[i] * signal_output_history[signal_output_history.size() - 1 - i]);
+
+    // each section filters the whole block in place (its delays are kept in registers)
+    for (SecondOrderSection & section : sections) {
+        double b0 = section.b0, b1 = section.b1, b2 = section.b2;
+        double a1 = section.a1, a2 = section.a2;
+        double state_1 = section.state_1, state_2 = section.state_2;
+        for (std::size_t i = 0; i < length; ++i) {
+            double section_input = output[i];
+            double result = b0 * section_input + state_1;
+            state_1 = b1 * section_input - a1 * result + state_2;
+            state_2 = b2 * section_input - a2 * result;
+            output[i] = (Sample) result;
+        }
+        section.state_1 = state_1;
+        section.state_2 = state_2;
     }
+}
 
-    // updates output history vector after calculation
-    // so k => 1 in -sum{k=1->M}(a_k * y[n - k])
-    signal_output_history.push_back(result);
-    signal_output_history.erase(signal_output_history.begin());
+void InfiniteImpulseResponseFilter::apply_filter_block(
+    const double * input, double * output, std::size_t length
+) {
+    /* Filters a block of samples (same result as calling apply_filter on each sample)
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     *     (may be the same as input)
+     * param length: Number of samples in the block
+     */
 
-    return result;
+    apply_sections(input, output, length);
+}
+
+void InfiniteImpulseResponseFilter::apply_filter_block(
+    const float * input, float * output, std::size_t length
+) {
+    /* Filters a block of single precision samples
+     *
+     * Only the samples passed between sections are rounded to float. The feedback (delays) stays in double
+     * precision, as poles close to the unit circle are too sensitive for float arithmetic.
+     *
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer (with at least length elements) that receives the filtered samples
+     *     (may be the same as input)
+     * param length: Number of samples in the block
+     */
+
+    apply_sections(input, output, length);
+}
+
+std::unique_ptr<Filter> InfiniteImpulseResponseFilter::clone() const {
+    /* Copies the filter (second order sections) with cleared delays
+     *
+     * return: The copied filter
+     */
+
+    std::unique_ptr<InfiniteImpulseResponseFilter> filter(new InfiniteImpulseResponseFilter(*this));
+    filter->reset();
+    return filter;
+}
+
+void InfiniteImpulseResponseFilter::reset() {
+    /* Clears the delays of every section (as if all previous inputs were 0) */
+
+    for (SecondOrderSection & section : sections) {
+        section.state_1 = 0.0;
+        section.state_2 = 0.0;
+    }
+}
+
+std::vector<SecondOrderSection> InfiniteImpulseResponseFilter::get_sections() {
+    /*
+     * return: Vector containing the second order sections of the filter
+     */
+    return sections;
 }
 
-// UNFINISHED
 void InfiniteImpulseResponseFilter::calculate_low_pass_coefficents(double cut_off_frequency) {
-    /* Calculates coefficients for a low pass IIR filter */
+    /* Calculates second order sections for a low pass IIR filter (bilinear transform with prewarping) */
+
+    ZerosPolesGain prototype = design_analog_prototype(design, filter_order, passband_ripple, stopband_attenuation);
+    double warped_cut_off = prewarp_frequency(cut_off_frequency, sampling_frequency);
+
+    ZerosPolesGain analog = transform_to_low_pass(prototype, warped_cut_off);
+    sections = convert_to_sections(bilinear_transform(analog, sampling_frequency));
 }
 
-// UNFINISHED
 void InfiniteImpulseResponseFilter::calculate_high_pass_coefficents(double cut_off_frequency) {
-    /* Calculates coefficients for a high pass IIR filter */
+    /* Calculates second order sections for a high pass IIR filter (bilinear transform with prewarping) */
+
+    ZerosPolesGain prototype = design_analog_prototype(design, filter_order, passband_ripple, stopband_attenuation);
+    double warped_cut_off = prewarp_frequency(cut_off_frequency, sampling_frequency);
+
+    ZerosPolesGain analog = transform_to_high_pass(prototype, warped_cut_off);
+    sections = convert_to_sections(bilinear_transform(analog, sampling_frequency));
 }
 
-// UNFINISHED
 void InfiniteImpulseResponseFilter::calculate_band_pass_coefficents(
     double cut_off_frequency_1, double cut_off_frequency_2
 ) {
-    /* Calculates coefficients for a band pass IIR filter */
+    /* Calculates second order sections for a band pass IIR filter (bilinear transform with prewarping) */
+
+    if (cut_off_frequency_1 >= cut_off_frequency_2) {
+        throw std::runtime_error("First cut off frequency must be lower than the second!");
+    }
+
+    ZerosPolesGain prototype = design_analog_prototype(design, filter_order, passband_ripple, stopband_attenuation);
+    double warped_cut_off_1 = prewarp_frequency(cut_off_frequency_1, sampling_frequency);
+    double warped_cut_off_2 = prewarp_frequency(cut_off_frequency_2, sampling_frequency);
+
+    // the band is centred on the geometric mean of the (prewarped) edges
+    ZerosPolesGain analog = transform_to_band_pass(
+        prototype, sqrt(warped_cut_off_1 * warped_cut_off_2), warped_cut_off_2 - warped_cut_off_1
+    );
+    sections = convert_to_sections(bilinear_transform(analog, sampling_frequency));
 }
 
-// UNFINISHED
 void InfiniteImpulseResponseFilter::calculate_band_stop_coefficents(
     double cut_off_frequency_1, double cut_off_frequency_2
 ) {
-    /* Calculates coefficients for a band stop IIR filter */
+    /* Calculates second order sections for a band stop IIR filter (bilinear transform with prewarping) */
+
+    if (cut_off_frequency_1 >= cut_off_frequency_2) {
+        throw std::runtime_error("First cut off frequency must be lower than the second!");
+    }
+
+    ZerosPolesGain prototype = design_analog_prototype(design, filter_order, passband_ripple, stopband_attenuation);
+    double warped_cut_off_1 = prewarp_frequency(cut_off_frequency_1, sampling_frequency);
+    double warped_cut_off_2 = prewarp_frequency(cut_off_frequency_2, sampling_frequency);
+
+    // the notch is centred on the geometric mean of the (prewarped) edges
+    ZerosPolesGain analog = transform_to_band_stop(
+        prototype, sqrt(warped_cut_off_1 * warped_cut_off_2), warped_cut_off_2 - warped_cut_off_1
+    );
+    sections = convert_to_sections(bilinear_transform(analog, sampling_frequency));
 }
 
 #endif
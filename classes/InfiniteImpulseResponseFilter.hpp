@@ -7,30 +7,38 @@
 
 #include <vector>
 #include <iostream>
+#include <algorithm>
 #include "Filter.hpp"
 
-// UNFINISHED
+/* Analog prototypes that IIR filters can be designed from */
+enum IIRDesign { butterworth, chebyshev_1, chebyshev_2, elliptic };
+
+typedef struct second_order_section {
+    // H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+    double b0, b1, b2;  // numerator (feedforward) coefficients
+    double a1, a2;  // denominator (feedback) coefficients, a0 is normalised to 1
+    double state_1, state_2;  // transposed direct form II delays
+} SecondOrderSection;
+
 class InfiniteImpulseResponseFilter: public Filter {
-    /* IIR filter class */
+    /* IIR filter class (cascade of second order sections) */
 
     private:
-        std::vector<double> b_coefficients;
-        std::vector<double> a_coefficients;
-        // previous inputs and outputs
-        std::vector<double> signal_input_history;
-        std::vector<double> signal_output_history;
+        std::vector<SecondOrderSection> sections;  // applied one after the other
         double sampling_frequency;
         int filter_order;
+        IIRDesign design;
+        double passband_ripple;  // dB (chebyshev_1 and elliptic)
+        double stopband_attenuation;  // dB (chebyshev_2 and elliptic)
+
+        template <typename Sample>
+        void apply_sections(const Sample * input, Sample * output, std::size_t length);
 
-        // UNFINISHED
         void calculate_low_pass_coefficents(double cut_off_frequency) override;
-        // UNFINISHED
         void calculate_high_pass_coefficents(double cut_off_frequency) override;
-        // UNFINISHED
         void calculate_band_pass_coefficents(
             double cut_off_frequency_1, double cut_off_frequency_2
         ) override;
-        // UNFINISHED
         void calculate_band_stop_coefficents(
             double cut_off_frequency_1, double cut_off_frequency_2
         ) override;
@@ -40,14 +48,24 @@ class InfiniteImpulseResponseFilter: public Filter {
             FilterType filter_type,
             double sampling_frequency,
             const std::vector<double>& cut_off_frequencies,
-            int filter_order
+            int filter_order,
+            IIRDesign design = butterworth,
+            double passband_ripple = 1.0,
+            double stopband_attenuation = 60.0
         );
+        InfiniteImpulseResponseFilter(const std::vector<SecondOrderSection>& sections, double sampling_frequency);
 
         void generate_coefficients(
             FilterType filter_type, const std::vector<double>& cut_off_frequencies
         ) override;
 
         double apply_filter(double sample) override;
+        void apply_filter_block(const double * input, double * output, std::size_t length) override;
+        void apply_filter_block(const float * input, float * output, std::size_t length) override;
+        std::unique_ptr<Filter> clone() const override;
+
+        void reset();
+        std::vector<SecondOrderSection> get_sections();
 };
 
 #endif //IIR_FILTER_HPP
@@ -0,0 +1,105 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MAPPED_SIGNAL_FILE_HPP
+
+#include "MappedSignalFile.hpp"
+
+MappedSignalFile::MappedSignalFile(const std::string& file_name) : mapped_file(file_name) {
+    /* Memory mapped signal file constructor (maps the file and checks its header)
+     *
+     * param file_name: Name of the signal file (no suffix is added)
+     */
+
+    if (mapped_file.size() < sizeof(SignalFileHeader)) {
+        throw std::runtime_error("File " + file_name + " is not a signal file!");
+    }
+    memcpy(&header, mapped_file.data(), sizeof(header));
+    if (memcmp(header.magic, signal_file_magic, 8) != 0) {
+        throw std::runtime_error("File " + file_name + " is not a signal file!");
+    }
+    if (header.version != signal_file_version || header.header_size < sizeof(SignalFileHeader)) {
+        throw std::runtime_error("Signal file " + file_name + " uses an unsupported version!");
+    }
+
+    std::size_t sample_size = get_sample_size((SampleType) header.sample_type);
+    // channels are returned as float/double pointers, so the payload must start on a whole sample
+    if (header.header_size % sample_size != 0) {
+        throw std::runtime_error("Signal file " + file_name + " has a misaligned header size!");
+    }
+    if (mapped_file.size() < header.header_size) {
+        throw std::runtime_error("Signal file " + file_name + " is too short!");
+    }
+    // divided rather than multiplied so corrupt sizes cannot overflow
+    std::size_t payload_size = mapped_file.size() - header.header_size;
+    if (header.num_channels > 0 && header.num_frames > payload_size / sample_size / header.num_channels) {
+        throw std::runtime_error("Signal file " + file_name + " is too short!");
+    }
+}
+
+const void * MappedSignalFile::get_channel(int channel, SampleType sample_type) const {
+    /* Finds the start of a channel within the mapping (checks the channel and sample type) */
+
+    if (channel < 0 || channel >= (int) header.num_channels) {
+        throw std::out_of_range("Channel " + std::to_string(channel) + " does not exist!");
+    }
+    if (header.sample_type != (std::uint32_t) sample_type) {
+        throw std::runtime_error("Signal file samples are not stored as the requested type!");
+    }
+    std::size_t offset = header.header_size + (std::size_t) channel * header.num_frames * get_sample_size(sample_type);
+    return mapped_file.data() + offset;
+}
+
+const float * MappedSignalFile::get_float_channel(int channel) const {
+    /*
+     * param channel: Index of the channel (the file must store float32 samples)
+     * return: Pointer to the channel's samples within the mapping
+     */
+    return (const float *) get_channel(channel, float32_samples);
+}
+
+const double * MappedSignalFile::get_double_channel(int channel) const {
+    /*
+     * param channel: Index of the channel (the file must store float64 samples)
+     * return: Pointer to the channel's samples within the mapping
+     */
+    return (const double *) get_channel(channel, float64_samples);
+}
+
+SampleType MappedSignalFile::get_sample_type() const {
+    /*
+     * return: Type the samples are stored as
+     */
+    return (SampleType) header.sample_type;
+}
+
+int MappedSignalFile::get_num_channels() const {
+    /*
+     * return: Number of channels
+     */
+    return (int) header.num_channels;
+}
+
+std::size_t MappedSignalFile::get_num_frames() const {
+    /*
+     * return: Number of samples in each channel
+     */
+    return (std::size_t) header.num_frames;
+}
+
+double MappedSignalFile::get_sample_rate() const {
+    /*
+     * return: Sample rate (in Hz)
+     */
+    return header.sample_rate;
+}
+
+double MappedSignalFile::get_start_time() const {
+    /*
+     * return: Time of the first sample (in seconds)
+     */
+    return header.start_time;
+}
+
+#endif
@@ -0,0 +1,42 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MAPPED_SIGNAL_FILE_HPP
+#define MAPPED_SIGNAL_FILE_HPP
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+
+#ifndef MEMORY_MAPPED_FILE_HPP
+#include "MemoryMappedFile.hpp"
+#endif
+
+#ifndef SIGNAL_FILE_HPP
+#include "../signal_file.hpp"
+#endif
+
+class MappedSignalFile {
+    /* Binary signal file that is memory mapped (channels are used in place, without reading or parsing) */
+
+    private:
+        MemoryMappedFile mapped_file;
+        SignalFileHeader header;
+
+        const void * get_channel(int channel, SampleType sample_type) const;
+
+    public:
+        explicit MappedSignalFile(const std::string& file_name);
+
+        const float * get_float_channel(int channel) const;
+        const double * get_double_channel(int channel) const;
+
+        SampleType get_sample_type() const;
+        int get_num_channels() const;
+        std::size_t get_num_frames() const;
+        double get_sample_rate() const;
+        double get_start_time() const;
+};
+
+#endif //MAPPED_SIGNAL_FILE_HPP
@@ -0,0 +1,190 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MAPPED_WAV_FILE_HPP
+
+#include "MappedWavFile.hpp"
+
+static std::uint32_t read_uint32(const unsigned char * bytes) {
+    /* Reads a little endian 32 bit unsigned integer */
+    return (std::uint32_t) bytes[0] | ((std::uint32_t) bytes[1] << 8)
+        | ((std::uint32_t) bytes[2] << 16) | ((std::uint32_t) bytes[3] << 24);
+}
+
+static std::uint16_t read_uint16(const unsigned char * bytes) {
+    /* Reads a little endian 16 bit unsigned integer */
+    return (std::uint16_t) (bytes[0] | (bytes[1] << 8));
+}
+
+static std::string add_wav_suffix(const std::string& file_name) {
+    /* Adds .wav to the file name if it doesn't already end with it */
+
+    if (file_name.length() < 4 || file_name.substr(file_name.length() - 4, 4) != ".wav") {
+        return file_name + ".wav";
+    }
+    return file_name;
+}
+
+MappedWavFile::MappedWavFile(const std::string& file_name) : mapped_file(add_wav_suffix(file_name)) {
+    /* Memory mapped WAV file constructor (maps the file and parses its header in place)
+     *
+     * param file_name: Name of the WAV file to map (.wav is added if missing)
+     */
+
+    mapped_data = (const unsigned char *) mapped_file.data();
+    mapped_size = mapped_file.size();
+    parse_header(add_wav_suffix(file_name));
+}
+
+void MappedWavFile::parse_header(const std::string& file_name) {
+    /* Finds the fmt and data chunks (other chunks such as JUNK and LIST are skipped) */
+
+    if (mapped_size < 12 || memcmp(mapped_data, "RIFF", 4) != 0 || memcmp(mapped_data + 8, "WAVE", 4) != 0) {
+        throw std::runtime_error("Error: File " + file_name + " is not a WAV file!");
+    }
+
+    bool found_fmt = false;
+    samples = nullptr;
+    std::size_t position = 12;
+    while (position + 8 <= mapped_size) {
+        const unsigned char * chunk = mapped_data + position;
+        std::size_t chunk_size = read_uint32(chunk + 4);
+        const unsigned char * chunk_data = chunk + 8;
+
+        if (memcmp(chunk, "fmt ", 4) == 0) {
+            if (chunk_size < 16 || position + 8 + chunk_size > mapped_size) break;
+            unsigned short audio_format = read_uint16(chunk_data);
+            num_channels = read_uint16(chunk_data + 2);
+            sample_rate = read_uint32(chunk_data + 4);
+            bits_per_sample = read_uint16(chunk_data + 14);
+            if (audio_format != 1 || bits_per_sample != 16 || num_channels == 0) {
+                throw std::runtime_error("Error: Only 16 bit PCM WAV files can be mapped (" + file_name + ")!");
+            }
+            found_fmt = true;
+        }
+        else if (memcmp(chunk, "data", 4) == 0) {
+            if (!found_fmt) break;
+            // a data chunk that runs past the end of the file (e.g. an unfinished recording) is cut short
+            std::size_t available = std::min(chunk_size, mapped_size - position - 8);
+            samples = (const signed short *) chunk_data;
+            num_frames = available / (sizeof(signed short) * num_channels);
+            return;
+        }
+        // chunks are padded to an even number of bytes
+        position += 8 + chunk_size + (chunk_size & 1);
+    }
+    throw std::runtime_error("Error: WAV file " + file_name + " has no fmt or data chunk!");
+}
+
+ChannelView MappedWavFile::get_channel(int channel) const {
+    /* Gets a view of one channel (no samples are copied)
+     *
+     * param channel: Index of the channel
+     * return: Strided view over the mapped data chunk
+     */
+
+    if (channel < 0 || channel >= num_channels) {
+        throw std::out_of_range("Channel " + std::to_string(channel) + " does not exist!");
+    }
+    return ChannelView(samples + channel, num_channels, num_frames);
+}
+
+const signed short * MappedWavFile::get_interleaved_data() const {
+    /*
+     * return: Pointer to the interleaved samples (num_frames * num_channels of them)
+     */
+    return samples;
+}
+
+void MappedWavFile::read_channel(
+    int channel, std::size_t first_frame, std::size_t frame_count, double * output
+) const {
+    /* Copies part of a channel into a buffer of normalised doubles (same scaling as convert_data_to_double)
+     *
+     * read_channels() should be used when every channel is needed (each frame is only touched once).
+     *
+     * param channel: Index of the channel
+     * param first_frame: First frame to copy
+     * param frame_count: Number of frames to copy (must not run past the end of the file)
+     * param output: Pointer to a buffer that receives frame_count samples
+     */
+
+    ChannelView view = get_channel(channel);
+    if (first_frame > num_frames || frame_count > num_frames - first_frame) {
+        throw std::out_of_range("Frames requested past the end of the WAV file!");
+    }
+    if (num_channels == 1) {
+        int16_to_double(view.data() + first_frame, output, frame_count);
+        return;
+    }
+
+    // the strided samples are gathered a block at a time so the SIMD conversion can be used
+    const std::size_t block_length = 4096;
+    signed short block[block_length];
+    for (std::size_t position = 0; position < frame_count; position += block_length) {
+        std::size_t length = std::min(block_length, frame_count - position);
+        for (std::size_t i = 0; i < length; ++i) {
+            block[i] = view[first_frame + position + i];
+        }
+        int16_to_double(block, output + position, length);
+    }
+}
+
+void MappedWavFile::read_channels(std::size_t first_frame, std::size_t frame_count, double * const * channels) const {
+    /* Copies part of every channel into buffers of normalised doubles (deinterleaved in one pass)
+     *
+     * param first_frame: First frame to copy
+     * param frame_count: Number of frames to copy (must not run past the end of the file)
+     * param channels: One pointer per channel to a buffer that receives frame_count samples
+     */
+
+    if (first_frame > num_frames || frame_count > num_frames - first_frame) {
+        throw std::out_of_range("Frames requested past the end of the WAV file!");
+    }
+    deinterleave_int16_to_double(samples + first_frame * num_channels, num_channels, frame_count, channels);
+}
+
+void MappedWavFile::read_channels(std::size_t first_frame, std::size_t frame_count, float * const * channels) const {
+    /* Copies part of every channel into buffers of normalised floats (deinterleaved in one pass)
+     *
+     * param first_frame: First frame to copy
+     * param frame_count: Number of frames to copy (must not run past the end of the file)
+     * param channels: One pointer per channel to a buffer that receives frame_count samples
+     */
+
+    if (first_frame > num_frames || frame_count > num_frames - first_frame) {
+        throw std::out_of_range("Frames requested past the end of the WAV file!");
+    }
+    deinterleave_int16_to_float(samples + first_frame * num_channels, num_channels, frame_count, channels);
+}
+
+std::size_t MappedWavFile::get_num_frames() const {
+    /*
+     * return: Number of samples in each channel
+     */
+    return num_frames;
+}
+
+unsigned short MappedWavFile::get_num_channels() const {
+    /*
+     * return: Number of channels
+     */
+    return num_channels;
+}
+
+unsigned int MappedWavFile::get_sample_rate() const {
+    /*
+     * return: Sample rate (in Hz)
+     */
+    return sample_rate;
+}
+
+unsigned short MappedWavFile::get_bits_per_sample() const {
+    /*
+     * return: Number of bits per sample (always 16)
+     */
+    return bits_per_sample;
+}
+
+#endif
@@ -0,0 +1,76 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MAPPED_WAV_FILE_HPP
+#define MAPPED_WAV_FILE_HPP
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#ifndef MEMORY_MAPPED_FILE_HPP
+#include "MemoryMappedFile.hpp"
+#endif
+
+#ifndef SAMPLE_CONVERSION_HPP
+#include "../sample_conversion.hpp"
+#endif
+
+class ChannelView {
+    /* Read only view of one channel of interleaved samples (every stride-th sample) */
+
+    private:
+        const signed short * first_sample;
+        std::size_t stride;  // number of interleaved channels
+        std::size_t length;  // number of frames
+
+    public:
+        ChannelView(const signed short * first_sample, std::size_t stride, std::size_t length)
+            : first_sample(first_sample), stride(stride), length(length) {}
+
+        signed short operator[](std::size_t frame) const { return first_sample[frame * stride]; }
+        std::size_t size() const { return length; }
+        std::size_t get_stride() const { return stride; }
+        const signed short * data() const { return first_sample; }
+};
+
+class MappedWavFile {
+    /* 16 bit PCM WAV file that is memory mapped instead of read (samples are only loaded when touched) */
+
+    private:
+        MemoryMappedFile mapped_file;
+        const unsigned char * mapped_data;  // start of the mapping (the RIFF header)
+        std::size_t mapped_size;
+
+        const signed short * samples;  // start of the data chunk
+        std::size_t num_frames;
+        unsigned short num_channels;
+        unsigned int sample_rate;
+        unsigned short bits_per_sample;
+
+        void parse_header(const std::string& file_name);
+
+    public:
+        explicit MappedWavFile(const std::string& file_name);
+
+        MappedWavFile(const MappedWavFile&) = delete;
+        MappedWavFile& operator=(const MappedWavFile&) = delete;
+
+        ChannelView get_channel(int channel) const;
+        const signed short * get_interleaved_data() const;
+
+        void read_channel(int channel, std::size_t first_frame, std::size_t frame_count, double * output) const;
+        void read_channels(std::size_t first_frame, std::size_t frame_count, double * const * channels) const;
+        void read_channels(std::size_t first_frame, std::size_t frame_count, float * const * channels) const;
+
+        std::size_t get_num_frames() const;
+        unsigned short get_num_channels() const;
+        unsigned int get_sample_rate() const;
+        unsigned short get_bits_per_sample() const;
+};
+
+#endif //MAPPED_WAV_FILE_HPP
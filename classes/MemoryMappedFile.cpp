@@ -0,0 +1,121 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MEMORY_MAPPED_FILE_HPP
+
+#include "MemoryMappedFile.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name) {
+    /* Maps the whole file read only (Windows)
+     *
+     * param file_name: Name of the file to map (empty files have no mapping and a size of 0)
+     */
+
+    mapped_data = nullptr;
+    mapping_handle = nullptr;
+    file_handle = CreateFileA(
+        file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Error: Failed to read file " + file_name + "!");
+    }
+
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(file_handle, &file_size);
+    mapped_size = (std::size_t) file_size.QuadPart;
+    if (mapped_size == 0) return;
+
+    mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle != nullptr) {
+        mapped_data = (const char *) MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (mapped_data == nullptr) {
+        unmap();
+        throw std::runtime_error("Error: Failed to map file " + file_name + "!");
+    }
+}
+
+void MemoryMappedFile::unmap() {
+    /* Releases the mapping and closes the file (Windows) */
+
+    if (mapped_data != nullptr) UnmapViewOfFile(mapped_data);
+    if (mapping_handle != nullptr) CloseHandle(mapping_handle);
+    CloseHandle(file_handle);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& file_name) {
+    /* Maps the whole file read only (POSIX)
+     *
+     * param file_name: Name of the file to map (empty files have no mapping and a size of 0)
+     */
+
+    mapped_data = nullptr;
+    file_descriptor = open(file_name.c_str(), O_RDONLY);
+    if (file_descriptor < 0) {
+        throw std::runtime_error("Error: Failed to read file " + file_name + "!");
+    }
+
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) != 0) {
+        close(file_descriptor);
+        throw std::runtime_error("Error: Failed to read file " + file_name + "!");
+    }
+    mapped_size = (std::size_t) file_status.st_size;
+    if (mapped_size == 0) return;
+
+    void * mapping = mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close(file_descriptor);
+        throw std::runtime_error("Error: Failed to map file " + file_name + "!");
+    }
+    // files are usually read from start to finish, so the kernel can read ahead
+    madvise(mapping, mapped_size, MADV_SEQUENTIAL);
+    mapped_data = (const char *) mapping;
+}
+
+void MemoryMappedFile::unmap() {
+    /* Releases the mapping and closes the file (POSIX) */
+
+    if (mapped_data != nullptr) munmap((void *) mapped_data, mapped_size);
+    close(file_descriptor);
+}
+
+#endif
+
+MemoryMappedFile::~MemoryMappedFile() {
+    /* Unmaps the file */
+    unmap();
+}
+
+const char * MemoryMappedFile::data() const {
+    /*
+     * return: Pointer to the first byte of the file (nullptr for empty files)
+     */
+    return mapped_data;
+}
+
+std::size_t MemoryMappedFile::size() const {
+    /*
+     * return: Size of the file (in bytes)
+     */
+    return mapped_size;
+}
+
+#endif
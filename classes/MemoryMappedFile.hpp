@@ -0,0 +1,38 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MEMORY_MAPPED_FILE_HPP
+#define MEMORY_MAPPED_FILE_HPP
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+
+class MemoryMappedFile {
+    /* Read only memory mapping of a whole file (pages are only loaded when touched) */
+
+    private:
+        const char * mapped_data;
+        std::size_t mapped_size;
+#ifdef _WIN32
+        void * file_handle;
+        void * mapping_handle;
+#else
+        int file_descriptor;
+#endif
+
+        void unmap();
+
+    public:
+        explicit MemoryMappedFile(const std::string& file_name);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        const char * data() const;
+        std::size_t size() const;
+};
+
+#endif //MEMORY_MAPPED_FILE_HPP
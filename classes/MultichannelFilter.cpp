@@ -0,0 +1,181 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MULTICHANNEL_FILTER_HPP
+
+#include "MultichannelFilter.hpp"
+
+MultichannelFilter::MultichannelFilter(const Filter& filter, int num_channels, int num_threads) {
+    /* Multichannel filter constructor
+     *
+     * param filter: Designed filter (its coefficients are copied once for each channel, its state is not)
+     * param num_channels: Number of channels to filter
+     * param num_threads: Maximum number of threads to filter channels with (0 uses one per hardware thread)
+     */
+
+    if (num_channels <= 0) {
+        throw std::invalid_argument("A multichannel filter needs at least one channel!");
+    }
+
+    prototype = filter.clone();
+    channel_filters.reserve(num_channels);
+    for (int i = 0; i < num_channels; ++i) {
+        channel_filters.push_back(prototype->clone());
+    }
+
+    if (num_threads <= 0) num_threads = ThreadPool::get_default_num_threads();
+    // there is no point having more threads than channels
+    num_threads = std::min(num_threads, num_channels);
+    if (num_threads > 1) {
+        thread_pool.reset(new ThreadPool(num_threads));
+    }
+}
+
+void MultichannelFilter::check_channel(int channel) {
+    /* Throws if the channel index is out of range */
+
+    if (channel < 0 || channel >= (int) channel_filters.size()) {
+        throw std::out_of_range("Channel " + std::to_string(channel) + " does not exist!");
+    }
+}
+
+double MultichannelFilter::apply_filter(int channel, double sample) {
+    /* Filters a single sample of one channel
+     *
+     * param channel: Index of the channel the sample belongs to
+     * param sample: Sample to filter
+     * return: The filtered sample
+     */
+
+    check_channel(channel);
+    return channel_filters[channel]->apply_filter(sample);
+}
+
+void MultichannelFilter::apply_filter_block(
+    int channel, const double * input, double * output, std::size_t length
+) {
+    /* Filters a block of samples of one channel (on the calling thread)
+     *
+     * param channel: Index of the channel the samples belong to
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer that receives length filtered samples
+     * param length: Number of samples to filter
+     */
+
+    check_channel(channel);
+    channel_filters[channel]->apply_filter_block(input, output, length);
+}
+
+void MultichannelFilter::apply_filter_block(
+    int channel, const float * input, float * output, std::size_t length
+) {
+    /* Filters a block of single precision samples of one channel (on the calling thread)
+     *
+     * param channel: Index of the channel the samples belong to
+     * param input: Pointer to the samples to filter
+     * param output: Pointer to a buffer that receives length filtered samples
+     * param length: Number of samples to filter
+     */
+
+    check_channel(channel);
+    channel_filters[channel]->apply_filter_block(input, output, length);
+}
+
+template <typename Sample>
+void MultichannelFilter::apply_filter_channels(
+    const std::vector<std::vector<Sample>>& input, std::vector<std::vector<Sample>>& output
+) {
+    /* Filters a block of every channel (each channel is a separate task on the thread pool)
+     *
+     * param input: Samples to filter (one vector per channel)
+     * param output: Receives the filtered samples (resized to match input)
+     */
+
+    if (input.size() != channel_filters.size()) {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(channel_filters.size()) + " channels but got "
+            + std::to_string(input.size()) + "!"
+        );
+    }
+
+    output.resize(input.size());
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        output[i].resize(input[i].size());
+    }
+
+    if (!thread_pool) {
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            channel_filters[i]->apply_filter_block(input[i].data(), output[i].data(), input[i].size());
+        }
+        return;
+    }
+
+    // channels never share a filter or an output vector, so no locking is needed
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        Filter * filter = channel_filters[i].get();
+        const std::vector<Sample> * channel_input = &input[i];
+        std::vector<Sample> * channel_output = &output[i];
+        thread_pool->submit([filter, channel_input, channel_output] {
+            filter->apply_filter_block(channel_input->data(), channel_output->data(), channel_input->size());
+        });
+    }
+    thread_pool->wait();
+}
+
+void MultichannelFilter::apply_filter_block(
+    const std::vector<std::vector<double>>& input, std::vector<std::vector<double>>& output
+) {
+    /* Filters a block of every channel in parallel
+     *
+     * param input: Samples to filter (one vector per channel)
+     * param output: Receives the filtered samples (resized to match input)
+     */
+
+    apply_filter_channels(input, output);
+}
+
+void MultichannelFilter::apply_filter_block(
+    const std::vector<std::vector<float>>& input, std::vector<std::vector<float>>& output
+) {
+    /* Filters a single precision block of every channel in parallel
+     *
+     * param input: Samples to filter (one vector per channel)
+     * param output: Receives the filtered samples (resized to match input)
+     */
+
+    apply_filter_channels(input, output);
+}
+
+void MultichannelFilter::reset() {
+    /* Clears the state of every channel */
+
+    for (std::unique_ptr<Filter>& channel_filter : channel_filters) {
+        channel_filter = prototype->clone();
+    }
+}
+
+int MultichannelFilter::get_num_channels() {
+    /*
+     * return: Number of channels
+     */
+    return (int) channel_filters.size();
+}
+
+int MultichannelFilter::get_num_threads() {
+    /*
+     * return: Number of threads channels are filtered with
+     */
+    return thread_pool ? thread_pool->get_num_threads() : 1;
+}
+
+Filter& MultichannelFilter::get_channel_filter(int channel) {
+    /*
+     * param channel: Index of the channel
+     * return: The filter used for that channel
+     */
+    check_channel(channel);
+    return *channel_filters[channel];
+}
+
+#endif
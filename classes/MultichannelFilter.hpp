@@ -0,0 +1,58 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef MULTICHANNEL_FILTER_HPP
+#define MULTICHANNEL_FILTER_HPP
+
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <cstddef>
+
+#ifndef FILTER_HPP
+#include "Filter.hpp"
+#endif
+
+#ifndef THREAD_POOL_HPP
+#include "ThreadPool.hpp"
+#endif
+
+class MultichannelFilter {
+    /* Applies one filter design to several channels (independent state per channel, channels run in parallel) */
+
+    private:
+        std::unique_ptr<Filter> prototype;  // cleared copy of the designed filter (used by reset)
+        std::vector<std::unique_ptr<Filter>> channel_filters;
+        std::unique_ptr<ThreadPool> thread_pool;  // only created when more than one thread is used
+
+        void check_channel(int channel);
+        template <typename Sample>
+        void apply_filter_channels(
+            const std::vector<std::vector<Sample>>& input, std::vector<std::vector<Sample>>& output
+        );
+
+    public:
+        MultichannelFilter(const Filter& filter, int num_channels, int num_threads = 0);
+
+        double apply_filter(int channel, double sample);
+        void apply_filter_block(int channel, const double * input, double * output, std::size_t length);
+        void apply_filter_block(
+            const std::vector<std::vector<double>>& input, std::vector<std::vector<double>>& output
+        );
+        // single precision versions (the precision can be chosen separately for each block)
+        void apply_filter_block(int channel, const float * input, float * output, std::size_t length);
+        void apply_filter_block(
+            const std::vector<std::vector<float>>& input, std::vector<std::vector<float>>& output
+        );
+
+        void reset();
+
+        int get_num_channels();
+        int get_num_threads();
+        Filter& get_channel_filter(int channel);
+};
+
+#endif //MULTICHANNEL_FILTER_HPP
@@ -0,0 +1,152 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef RATIONAL_RESAMPLER_HPP
+
+#include "RationalResampler.hpp"
+
+RationalResampler::RationalResampler(int input_rate, int output_rate, int filter_length) {
+    /* Rational resampler constructor
+     *
+     * param input_rate: Sample rate of the input (e.g. 44100)
+     * param output_rate: Sample rate of the output (e.g. 48000), the ratio is reduced to L/M (160/147)
+     * param filter_length: Length of the anti-aliasing filter in samples of the lower rate (longer is sharper)
+     */
+
+    if (input_rate < 1 || output_rate < 1) {
+        throw std::invalid_argument("Sample rates of a resampler must be positive!");
+    }
+    if (filter_length < 2) {
+        throw std::invalid_argument("Anti-aliasing filter of a resampler must be at least 2 samples long!");
+    }
+    int divisor = std::gcd(input_rate, output_rate);
+    up_factor = output_rate / divisor;
+    down_factor = input_rate / divisor;
+
+    // the filter runs at L times the input rate (input rate = 1), and must remove everything above the lower
+    // of the two Nyquist frequencies
+    double upsampled_rate = up_factor;
+    double cut_off = resampler_cut_off_ratio * 0.5 * std::min(1.0, (double) up_factor / down_factor);
+    // the length is set at the lower rate, so the transition band is the same fraction of the output bandwidth
+    // when downsampling (each output then uses about filter_length * M / L inputs)
+    int num_taps = (filter_length * std::max(up_factor, down_factor)) / 2;
+    filter_delay = num_taps;
+    // every channel (and every file) converted between the same rates uses the same design
+    std::vector<double> coefficients = *CoefficientCache::get_instance().get_coefficients(
+        {low_pass, upsampled_rate, {cut_off}, num_taps, blackman}
+    );
+
+    // inserting zeros divides the level of the signal by L, so the gain of the filter is L
+    for (double& coefficient : coefficients) coefficient *= up_factor;
+    reversed_branches = split_polyphase(coefficients, up_factor);
+    branch_length = (int) reversed_branches[0].size();
+    reset();
+}
+
+void RationalResampler::reset() {
+    /* Clears the input history (as if all previous inputs were 0), so the next input gives the first output */
+
+    block_buffer.assign(branch_length - 1, 0.0);
+    next_output_time = 0;
+}
+
+std::size_t RationalResampler::apply_filter_block(const double * input, double * output, std::size_t length) {
+    /* Resamples a block of samples (continues from the previous block)
+     *
+     * Each output is written as soon as its newest input arrives, so the number of outputs from a block depends on
+     * where the previous block stopped.
+     *
+     * param input: Pointer to the samples to resample
+     * param output: Pointer to a buffer (with at least get_max_output_length(length) elements) that receives the
+     *     resampled samples
+     * param length: Number of samples in the block
+     * return: Number of outputs written
+     */
+
+    const int chunk_length = 4096;  // bounds the size of the block buffer
+    int num_previous = branch_length - 1;
+    block_buffer.resize(num_previous + chunk_length);
+
+    std::size_t num_outputs = 0;
+    std::size_t position = 0;
+    while (position < length) {
+        int num_inputs = (int) std::min<std::size_t>(chunk_length, length - position);
+        // the previous inputs are already at the start of the buffer
+        std::copy(input + position, input + position + num_inputs, block_buffer.begin() + num_previous);
+
+        long long chunk_end_time = (long long) num_inputs * up_factor;
+        for (; next_output_time < chunk_end_time; next_output_time += down_factor) {
+            int phase = (int) (next_output_time % up_factor);
+            int newest_input = (int) (next_output_time / up_factor);
+            // the newest input of the window is at num_previous + newest_input in the buffer
+            output[num_outputs++] = dot_product(
+                reversed_branches[phase].data(), &block_buffer[newest_input], branch_length
+            );
+        }
+        next_output_time -= chunk_end_time;
+
+        // the newest K - 1 inputs become the previous inputs of the next chunk
+        std::copy(
+            block_buffer.begin() + num_inputs, block_buffer.begin() + num_inputs + num_previous, block_buffer.begin()
+        );
+        position += num_inputs;
+    }
+    block_buffer.resize(num_previous);
+    return num_outputs;
+}
+
+std::size_t RationalResampler::get_max_output_length(std::size_t input_length) const {
+    /*
+     * param input_length: Number of samples in a block
+     * return: Largest number of outputs that apply_filter_block can write for the block (ceil(length * L / M))
+     */
+    return (input_length * up_factor + down_factor - 1) / down_factor;
+}
+
+int RationalResampler::get_up_factor() const {
+    /*
+     * return: Upsampling factor (L)
+     */
+    return up_factor;
+}
+
+int RationalResampler::get_down_factor() const {
+    /*
+     * return: Downsampling factor (M)
+     */
+    return down_factor;
+}
+
+double RationalResampler::get_delay() const {
+    /*
+     * return: Delay of the anti-aliasing filter in input samples (outputs lag the inputs by this much)
+     */
+    return (double) filter_delay / up_factor;
+}
+
+std::vector<std::vector<double>> resample_channels(
+    const std::vector<std::vector<double>>& data, int input_rate, int output_rate, int filter_length
+) {
+    /* Resamples every channel of a signal with its own resampler
+     *
+     * param data: Samples to resample (one vector per channel)
+     * param input_rate: Sample rate of the data
+     * param output_rate: Sample rate to convert to
+     * param filter_length: Length of the anti-aliasing filter in samples of the lower rate
+     * return: Resampled samples (one vector per channel)
+     */
+
+    const RationalResampler prototype = RationalResampler(input_rate, output_rate, filter_length);
+    std::vector<std::vector<double>> resampled_data;
+    resampled_data.reserve(data.size());
+    for (const std::vector<double>& channel : data) {
+        RationalResampler resampler = prototype;
+        std::vector<double> resampled_channel(resampler.get_max_output_length(channel.size()));
+        resampled_channel.resize(resampler.apply_filter_block(channel.data(), resampled_channel.data(), channel.size()));
+        resampled_data.push_back(std::move(resampled_channel));
+    }
+    return resampled_data;
+}
+
+#endif
@@ -0,0 +1,65 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef RATIONAL_RESAMPLER_HPP
+#define RATIONAL_RESAMPLER_HPP
+
+#include <vector>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef FIR_FILTER_HPP
+#include "FiniteImpulseResponseFilter.hpp"
+#endif
+
+#ifndef COEFFICIENT_CACHE_HPP
+#include "CoefficientCache.hpp"
+#endif
+
+#ifndef POLYPHASE_HPP
+#include "../polyphase.hpp"
+#endif
+
+// the anti-aliasing filter passes frequencies up to this fraction of the lower Nyquist frequency
+const double resampler_cut_off_ratio = 0.9;
+
+class RationalResampler {
+    /* Changes the sample rate of a signal by a rational factor L/M (up by L, then down by M)
+     *
+     * Upsampling inserts L - 1 zeros between inputs and downsampling keeps every Mth sample, with a windowed sinc
+     * low pass filter in between (designed by FiniteImpulseResponseFilter at L times the input rate). The filter
+     * is split into L polyphase branches, so each output is a short dot product of the real inputs: output m
+     * uses branch (mM mod L) on the inputs up to floor(mM / L).
+     *
+     * Blocks are processed as they arrive (streaming), so the only latency is the filter delay (get_delay).
+     */
+
+    private:
+        int up_factor;  // L
+        int down_factor;  // M
+        int branch_length;  // coefficients per branch (K)
+        int filter_delay;  // delay of the anti-aliasing filter in upsampled samples (its num_taps)
+        std::vector<std::vector<double>> reversed_branches;  // polyphase branches (see split_polyphase)
+        std::vector<double> block_buffer;  // K - 1 previous inputs followed by a chunk of new inputs
+        long long next_output_time;  // time of the next output (in upsampled samples from the next input)
+
+    public:
+        RationalResampler(int input_rate, int output_rate, int filter_length = 64);
+
+        std::size_t apply_filter_block(const double * input, double * output, std::size_t length);
+        void reset();
+
+        std::size_t get_max_output_length(std::size_t input_length) const;
+        int get_up_factor() const;
+        int get_down_factor() const;
+        double get_delay() const;
+};
+
+std::vector<std::vector<double>> resample_channels(
+    const std::vector<std::vector<double>>& data, int input_rate, int output_rate, int filter_length = 64
+);
+
+#endif //RATIONAL_RESAMPLER_HPP
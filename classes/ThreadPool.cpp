@@ -0,0 +1,105 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef THREAD_POOL_HPP
+
+#include "ThreadPool.hpp"
+
+ThreadPool::ThreadPool(int num_threads) {
+    /* Thread pool constructor (the workers are started immediately)
+     *
+     * param num_threads: Number of worker threads (0 uses one per hardware thread)
+     */
+
+    if (num_threads <= 0) num_threads = get_default_num_threads();
+
+    num_busy_tasks = 0;
+    stopping = false;
+    for (int i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&ThreadPool::worker_loop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    /* Finishes the queued tasks and joins the workers */
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stopping = true;
+    }
+    task_available.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::worker_loop() {
+    /* Runs tasks until the pool is destroyed */
+
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            task_available.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) return;  // only reached when stopping
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+
+        std::exception_ptr exception;
+        try {
+            task();
+        }
+        catch (...) {
+            exception = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (exception && !first_exception) first_exception = exception;
+        if (--num_busy_tasks == 0) tasks_finished.notify_all();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    /* Queues a task to be run by the next free worker
+     *
+     * param task: Function to run (exceptions it throws are passed on by wait())
+     */
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        tasks.push(std::move(task));
+        ++num_busy_tasks;
+    }
+    task_available.notify_one();
+}
+
+void ThreadPool::wait() {
+    /* Blocks until every submitted task has finished (rethrows the first exception thrown by a task) */
+
+    std::unique_lock<std::mutex> lock(queue_mutex);
+    tasks_finished.wait(lock, [this] { return num_busy_tasks == 0; });
+    if (first_exception) {
+        std::exception_ptr exception = first_exception;
+        first_exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+int ThreadPool::get_num_threads() {
+    /*
+     * return: Number of worker threads
+     */
+    return (int) workers.size();
+}
+
+int ThreadPool::get_default_num_threads() {
+    /*
+     * return: Number of hardware threads (at least 1)
+     */
+    unsigned int num_threads = std::thread::hardware_concurrency();
+    return num_threads == 0 ? 1 : (int) num_threads;
+}
+
+#endif
@@ -0,0 +1,46 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+class ThreadPool {
+    /* Fixed number of worker threads that run queued tasks */
+
+    private:
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex queue_mutex;
+        std::condition_variable task_available;  // signalled when a task is queued (or the pool stops)
+        std::condition_variable tasks_finished;  // signalled when the last running task finishes
+        int num_busy_tasks;  // queued + running tasks
+        bool stopping;
+        std::exception_ptr first_exception;  // rethrown by wait()
+
+        void worker_loop();
+
+    public:
+        explicit ThreadPool(int num_threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(std::function<void()> task);
+        void wait();
+
+        int get_num_threads();
+
+        static int get_default_num_threads();
+};
+
+#endif //THREAD_POOL_HPP
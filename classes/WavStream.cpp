@@ -0,0 +1,388 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef WAV_STREAM_HPP
+
+#include "WavStream.hpp"
+
+// size of the header written by WavWriter ("RIFF" + "WAVE" + 16 byte "fmt " chunk + "data" chunk header)
+static const long wav_header_size = 44;
+
+static std::uint32_t read_uint32(const unsigned char * bytes) {
+    /* Reads a little endian 32 bit unsigned integer */
+    return (std::uint32_t) bytes[0] | ((std::uint32_t) bytes[1] << 8)
+        | ((std::uint32_t) bytes[2] << 16) | ((std::uint32_t) bytes[3] << 24);
+}
+
+static std::uint16_t read_uint16(const unsigned char * bytes) {
+    /* Reads a little endian 16 bit unsigned integer */
+    return (std::uint16_t) (bytes[0] | (bytes[1] << 8));
+}
+
+static void write_uint32(unsigned char * bytes, std::uint32_t value) {
+    /* Writes a little endian 32 bit unsigned integer */
+    bytes[0] = (unsigned char) value;
+    bytes[1] = (unsigned char) (value >> 8);
+    bytes[2] = (unsigned char) (value >> 16);
+    bytes[3] = (unsigned char) (value >> 24);
+}
+
+static void write_uint16(unsigned char * bytes, std::uint16_t value) {
+    /* Writes a little endian 16 bit unsigned integer */
+    bytes[0] = (unsigned char) value;
+    bytes[1] = (unsigned char) (value >> 8);
+}
+
+static std::string add_wav_suffix(const std::string& file_name) {
+    /* Adds .wav to the file name if it doesn't already end with it */
+
+    if (file_name.length() < 4 || file_name.substr(file_name.length() - 4, 4) != ".wav") {
+        return file_name + ".wav";
+    }
+    return file_name;
+}
+
+WavReader::WavReader(const std::string& file_name) {
+    /* WAV reader constructor (opens the file and reads the header, samples are read by read_block)
+     *
+     * param file_name: Name of the WAV file to read (.wav is added if missing)
+     */
+
+    std::string full_file_name = add_wav_suffix(file_name);
+    fp = fopen(full_file_name.c_str(), "rb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Error: Failed to read file " + full_file_name + "!");
+    }
+    try {
+        read_header(full_file_name);
+    }
+    catch (...) {
+        fclose(fp);
+        throw;
+    }
+    frames_read = 0;
+}
+
+WavReader::~WavReader() {
+    /* Closes the file */
+    fclose(fp);
+}
+
+void WavReader::read_header(const std::string& file_name) {
+    /* Reads chunks until the data chunk is reached (chunks other than fmt and data are skipped) */
+
+    unsigned char riff_header[12];
+    if (fread(riff_header, 1, 12, fp) != 12 || memcmp(riff_header, "RIFF", 4) != 0
+        || memcmp(riff_header + 8, "WAVE", 4) != 0) {
+        throw std::runtime_error("Error: File " + file_name + " is not a WAV file!");
+    }
+
+    bool found_fmt = false;
+    unsigned char chunk_header[8];
+    while (fread(chunk_header, 1, 8, fp) == 8) {
+        std::uint32_t chunk_size = read_uint32(chunk_header + 4);
+
+        if (memcmp(chunk_header, "fmt ", 4) == 0) {
+            unsigned char fmt_chunk[16];
+            if (chunk_size < 16 || fread(fmt_chunk, 1, 16, fp) != 16) break;
+            unsigned short audio_format = read_uint16(fmt_chunk);
+            num_channels = read_uint16(fmt_chunk + 2);
+            sample_rate = read_uint32(fmt_chunk + 4);
+            unsigned short bits_per_sample = read_uint16(fmt_chunk + 14);
+            if (audio_format != 1 || bits_per_sample != 16 || num_channels == 0) {
+                throw std::runtime_error("Error: Only 16 bit PCM WAV files can be streamed (" + file_name + ")!");
+            }
+            found_fmt = true;
+            // skips extra fmt parameters (and the padding byte of odd sized chunks)
+            fseek(fp, (long) (chunk_size - 16 + (chunk_size & 1)), SEEK_CUR);
+        }
+        else if (memcmp(chunk_header, "data", 4) == 0) {
+            if (!found_fmt) break;
+            num_frames = chunk_size / (sizeof(signed short) * num_channels);
+            return;
+        }
+        else {
+            // chunks are padded to an even number of bytes
+            fseek(fp, (long) (chunk_size + (chunk_size & 1)), SEEK_CUR);
+        }
+    }
+    throw std::runtime_error("Error: WAV file " + file_name + " has no fmt or data chunk!");
+}
+
+std::size_t WavReader::read_interleaved(signed short * samples, std::size_t max_frames) {
+    /* Reads the next frames without splitting them by channel
+     *
+     * param samples: Pointer to a buffer with room for max_frames * num_channels samples
+     * param max_frames: Maximum number of frames to read
+     * return: Number of frames read (0 once the end of the data chunk is reached)
+     */
+
+    std::size_t frames_wanted = std::min(max_frames, num_frames - frames_read);
+    std::size_t samples_read = fread(samples, sizeof(signed short), frames_wanted * num_channels, fp);
+    std::size_t frames_in_block = samples_read / num_channels;
+    if (frames_in_block < frames_wanted) {
+        // the file ended before the end of the data chunk (e.g. an unfinished recording)
+        num_frames = frames_read + frames_in_block;
+    }
+    frames_read += frames_in_block;
+    return frames_in_block;
+}
+
+std::size_t WavReader::read_block(std::vector<std::vector<double>>& block, std::size_t max_frames) {
+    /* Reads the next frames as normalised doubles (same scaling as convert_data_to_double)
+     *
+     * param block: Receives one vector per channel (resized to the number of frames read)
+     * param max_frames: Maximum number of frames to read
+     * return: Number of frames read (0 once the end of the data chunk is reached)
+     */
+
+    interleaved_block.resize(std::min(max_frames, num_frames - frames_read) * num_channels);
+    std::size_t frames_in_block = read_interleaved(interleaved_block.data(), max_frames);
+
+    // splits the frames by channel while converting them (SIMD kernel)
+    block.resize(num_channels);
+    std::vector<double *> channels(num_channels);
+    for (int j = 0; j < num_channels; ++j) {
+        block[j].resize(frames_in_block);
+        channels[j] = block[j].data();
+    }
+    deinterleave_int16_to_double(interleaved_block.data(), num_channels, frames_in_block, channels.data());
+    return frames_in_block;
+}
+
+std::size_t WavReader::get_num_frames() {
+    /*
+     * return: Number of frames in the data chunk
+     */
+    return num_frames;
+}
+
+std::size_t WavReader::get_frames_remaining() {
+    /*
+     * return: Number of frames that haven't been read yet
+     */
+    return num_frames - frames_read;
+}
+
+unsigned short WavReader::get_num_channels() {
+    /*
+     * return: Number of channels
+     */
+    return num_channels;
+}
+
+unsigned int WavReader::get_sample_rate() {
+    /*
+     * return: Sample rate (in Hz)
+     */
+    return sample_rate;
+}
+
+WavWriter::WavWriter(const std::string& file_name, unsigned short num_channels, double sample_rate) {
+    /* WAV writer constructor (writes a header with empty sizes, which close() fills in)
+     *
+     * param file_name: Name of the WAV file to write (.wav is added if missing)
+     * param num_channels: Number of channels
+     * param sample_rate: Sample rate of the signal (rounded to a whole number of Hz)
+     */
+
+    if (num_channels == 0) {
+        throw std::invalid_argument("A WAV file needs at least one channel!");
+    }
+
+    this->file_name = add_wav_suffix(file_name);
+    this->num_channels = num_channels;
+    this->sample_rate = (unsigned int) lround(sample_rate);
+    data_bytes = 0;
+    clipped = false;
+
+    fp = fopen(this->file_name.c_str(), "wb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Error: Failed to write file " + this->file_name + "!");
+    }
+    write_header();
+}
+
+WavWriter::~WavWriter() {
+    /* Closes the file if close() wasn't called (errors can't be reported here) */
+
+    if (fp == nullptr) return;
+    try {
+        close();
+    }
+    catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+    }
+}
+
+void WavWriter::write_header() {
+    /* Writes the 44 byte header at the start of the file (sizes are based on the data written so far) */
+
+    unsigned short block_align = num_channels * sizeof(signed short);
+    unsigned char header[wav_header_size];
+    memcpy(header, "RIFF", 4);
+    // total chunk size = (bytes of IDs) + (bytes of chunk sizes) + (fmt chunk size) + (data chunk size)
+    write_uint32(header + 4, (std::uint32_t) (wav_header_size - 8 + data_bytes));
+    memcpy(header + 8, "WAVE", 4);
+    memcpy(header + 12, "fmt ", 4);
+    write_uint32(header + 16, 16);  // 16 for PCM
+    write_uint16(header + 20, 1);  // PCM is used
+    write_uint16(header + 22, num_channels);
+    write_uint32(header + 24, sample_rate);
+    write_uint32(header + 28, sample_rate * block_align);  // byte rate
+    write_uint16(header + 32, block_align);
+    write_uint16(header + 34, 16);  // 16 bit signals are used
+    memcpy(header + 36, "data", 4);
+    write_uint32(header + 40, (std::uint32_t) data_bytes);
+
+    if (fseek(fp, 0, SEEK_SET) != 0 || fwrite(header, 1, wav_header_size, fp) != wav_header_size) {
+        throw std::runtime_error("Error: Failed to write the header of " + file_name + "!");
+    }
+}
+
+void WavWriter::write_interleaved(const signed short * samples, std::size_t num_frames) {
+    /* Appends frames that are already interleaved
+     *
+     * param samples: Pointer to num_frames * num_channels samples
+     * param num_frames: Number of frames to write
+     */
+
+    if (fp == nullptr) {
+        throw std::runtime_error("Error: WAV file " + file_name + " has already been closed!");
+    }
+    std::uint64_t block_bytes = (std::uint64_t) num_frames * num_channels * sizeof(signed short);
+    // the RIFF chunk size is a 32 bit number
+    if (wav_header_size - 8 + data_bytes + block_bytes > UINT32_MAX) {
+        throw std::runtime_error("Error: WAV file " + file_name + " can't be larger than 4 GB!");
+    }
+    if (fwrite(samples, sizeof(signed short), num_frames * num_channels, fp) != num_frames * num_channels) {
+        throw std::runtime_error("Error: Failed to write samples to " + file_name + "!");
+    }
+    data_bytes += block_bytes;
+}
+
+void WavWriter::write_block(const std::vector<std::vector<double>>& block) {
+    /* Appends a block of normalised samples (clipped and rounded the same way as convert_data_to_short)
+     *
+     * param block: One vector per channel (all channels must be the same length)
+     */
+
+    if (block.size() != num_channels) {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(num_channels) + " channels but got " + std::to_string(block.size()) + "!"
+        );
+    }
+    std::size_t num_frames = block[0].size();
+    for (const std::vector<double>& channel : block) {
+        if (channel.size() != num_frames) {
+            throw std::invalid_argument("Every channel in a block must have the same number of frames!");
+        }
+    }
+
+    // reverses normalisation, clips and interleaves the channels in one pass (SIMD kernel)
+    std::vector<const double *> channels(num_channels);
+    for (int j = 0; j < num_channels; ++j) {
+        channels[j] = block[j].data();
+    }
+    interleaved_block.resize(num_frames * num_channels);
+    if (interleave_double_to_int16(channels.data(), num_channels, num_frames, interleaved_block.data())) {
+        clipped = true;
+    }
+    write_interleaved(interleaved_block.data(), num_frames);
+}
+
+void WavWriter::close() {
+    /* Fills in the chunk sizes and closes the file */
+
+    if (fp == nullptr) return;
+    FILE * file = fp;
+    try {
+        write_header();
+    }
+    catch (...) {
+        fclose(file);
+        fp = nullptr;
+        throw;
+    }
+    fp = nullptr;
+    if (fclose(file) != 0) {
+        throw std::runtime_error("Error: Failed to write file " + file_name + "!");
+    }
+    if (clipped) std::cout << "Warning: Some data was clipped while writing the file" << std::endl;
+}
+
+std::size_t WavWriter::get_frames_written() {
+    /*
+     * return: Number of frames written so far
+     */
+    return (std::size_t) (data_bytes / (num_channels * sizeof(signed short)));
+}
+
+void filter_wav_file(
+    const std::string& input_file_name,
+    const std::string& output_file_name,
+    const Filter& filter,
+    std::size_t block_frames
+) {
+    /* Filters a WAV file into a new WAV file one block at a time (memory use doesn't depend on the file length)
+     *
+     * param input_file_name: Name of the WAV file to filter
+     * param output_file_name: Name of the filtered WAV file
+     * param filter: Designed filter (each channel gets its own copy)
+     * param block_frames: Number of frames read, filtered and written at a time
+     */
+
+    WavReader reader(input_file_name);
+    WavWriter writer(output_file_name, reader.get_num_channels(), reader.get_sample_rate());
+    MultichannelFilter multichannel_filter = MultichannelFilter(filter, reader.get_num_channels());
+
+    std::vector<std::vector<double>> block, filtered_block;
+    while (reader.read_block(block, block_frames) > 0) {
+        multichannel_filter.apply_filter_block(block, filtered_block);
+        writer.write_block(filtered_block);
+    }
+    writer.close();
+}
+
+void resample_wav_file(
+    const std::string& input_file_name,
+    const std::string& output_file_name,
+    int output_sample_rate,
+    int filter_length,
+    std::size_t block_frames
+) {
+    /* Converts a WAV file to another sample rate one block at a time (e.g. 44100 Hz recordings to 48000 Hz)
+     *
+     * Outputs are delayed by the anti-aliasing filter (RationalResampler::get_delay), and the file ends when the
+     * last input arrives, so the final outputs of the filter are not written.
+     *
+     * param input_file_name: Name of the WAV file to resample
+     * param output_file_name: Name of the resampled WAV file
+     * param output_sample_rate: Sample rate of the new file
+     * param filter_length: Length of the anti-aliasing filter in samples of the lower rate
+     * param block_frames: Number of frames read, resampled and written at a time
+     */
+
+    WavReader reader(input_file_name);
+    WavWriter writer(output_file_name, reader.get_num_channels(), output_sample_rate);
+    const RationalResampler prototype = RationalResampler(
+        (int) reader.get_sample_rate(), output_sample_rate, filter_length
+    );
+    std::vector<RationalResampler> resamplers(reader.get_num_channels(), prototype);
+
+    std::vector<std::vector<double>> block, resampled_block(reader.get_num_channels());
+    while (reader.read_block(block, block_frames) > 0) {
+        // every channel is at the same point, so they all give the same number of outputs
+        for (std::size_t j = 0; j < block.size(); ++j) {
+            resampled_block[j].resize(resamplers[j].get_max_output_length(block[j].size()));
+            resampled_block[j].resize(
+                resamplers[j].apply_filter_block(block[j].data(), resampled_block[j].data(), block[j].size())
+            );
+        }
+        writer.write_block(resampled_block);
+    }
+    writer.close();
+}
+
+#endif
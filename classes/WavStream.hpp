@@ -0,0 +1,103 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef WAV_STREAM_HPP
+#define WAV_STREAM_HPP
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+#include <algorithm>
+
+#ifndef SAMPLE_CONVERSION_HPP
+#include "../sample_conversion.hpp"
+#endif
+
+#ifndef MULTICHANNEL_FILTER_HPP
+#include "MultichannelFilter.hpp"
+#endif
+
+#ifndef RATIONAL_RESAMPLER_HPP
+#include "RationalResampler.hpp"
+#endif
+
+class WavReader {
+    /* Reads a 16 bit PCM WAV file a block of frames at a time */
+
+    private:
+        FILE * fp;
+        unsigned short num_channels;
+        unsigned int sample_rate;
+        std::size_t num_frames;
+        std::size_t frames_read;
+        std::vector<signed short> interleaved_block;
+
+        void read_header(const std::string& file_name);
+
+    public:
+        explicit WavReader(const std::string& file_name);
+        ~WavReader();
+
+        WavReader(const WavReader&) = delete;
+        WavReader& operator=(const WavReader&) = delete;
+
+        std::size_t read_block(std::vector<std::vector<double>>& block, std::size_t max_frames);
+        std::size_t read_interleaved(signed short * samples, std::size_t max_frames);
+
+        std::size_t get_num_frames();
+        std::size_t get_frames_remaining();
+        unsigned short get_num_channels();
+        unsigned int get_sample_rate();
+};
+
+class WavWriter {
+    /* Writes a 16 bit PCM WAV file a block of frames at a time (the header sizes are filled in by close) */
+
+    private:
+        FILE * fp;
+        std::string file_name;
+        unsigned short num_channels;
+        unsigned int sample_rate;
+        std::uint64_t data_bytes;
+        bool clipped;
+        std::vector<signed short> interleaved_block;
+
+        void write_header();
+
+    public:
+        WavWriter(const std::string& file_name, unsigned short num_channels, double sample_rate);
+        ~WavWriter();
+
+        WavWriter(const WavWriter&) = delete;
+        WavWriter& operator=(const WavWriter&) = delete;
+
+        void write_block(const std::vector<std::vector<double>>& block);
+        void write_interleaved(const signed short * samples, std::size_t num_frames);
+        void close();
+
+        std::size_t get_frames_written();
+};
+
+void filter_wav_file(
+    const std::string& input_file_name,
+    const std::string& output_file_name,
+    const Filter& filter,
+    std::size_t block_frames = 1 << 16
+);
+
+void resample_wav_file(
+    const std::string& input_file_name,
+    const std::string& output_file_name,
+    int output_sample_rate,
+    int filter_length = 64,
+    std::size_t block_frames = 1 << 16
+);
+
+#endif //WAV_STREAM_HPP
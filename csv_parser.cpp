@@ -0,0 +1,451 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef CSV_PARSER_HPP
+
+#include "csv_parser.hpp"
+
+#include <filesystem>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CSV_PARSER_X86_64
+#include <emmintrin.h>
+#endif
+
+static int count_bits(unsigned int mask) {
+    /* Counts the set bits of a 16 bit movemask */
+#if defined(__GNUC__)
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) ++count;
+    return count;
+#endif
+}
+
+std::size_t count_newlines(const char * begin, const char * end) {
+    /* Counts the '\n' characters in a buffer (16 bytes at a time with SSE2)
+     *
+     * param begin: Pointer to the first character
+     * param end: Pointer one past the last character
+     * return: Number of newlines
+     */
+
+    std::size_t count = 0;
+    const char * position = begin;
+#ifdef CSV_PARSER_X86_64
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; position + 16 <= end; position += 16) {
+        __m128i characters = _mm_loadu_si128((const __m128i *) position);
+        count += count_bits((unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(characters, newline)));
+    }
+#endif
+    for (; position < end; ++position) {
+        if (*position == '\n') ++count;
+    }
+    return count;
+}
+
+static const char * skip_spaces(const char * position, const char * end) {
+    /* Skips spaces, tabs and carriage returns (stod also ignores them) */
+
+    while (position < end && (*position == ' ' || *position == '\t' || *position == '\r')) ++position;
+    return position;
+}
+
+static bool is_end_of_row(const char * position, const char * end) {
+    /* Checks if a row ends at this position */
+    return position == end || *position == '\n';
+}
+
+static const char * parse_csv_row(
+    const char * position, const char * end, std::vector<double> & row, std::size_t line_number
+) {
+    /* Parses one row of numbers (a blank row gives no values)
+     *
+     * param position: Pointer to the start of the row
+     * param end: Pointer one past the end of the buffer
+     * param row: Receives the values of the row
+     * param line_number: Line number of the row (used for errors)
+     * return: Pointer to the start of the next row
+     */
+
+    row.clear();
+    position = skip_spaces(position, end);
+    // empty lines are skipped
+    if (is_end_of_row(position, end)) return (position < end) ? position + 1 : position;
+
+    while (true) {
+        // from_chars doesn't accept a leading '+' (stod does)
+        if (position < end && *position == '+') ++position;
+
+        double value;
+        std::from_chars_result result = std::from_chars(position, end, value);
+        if (result.ec == std::errc::invalid_argument) {
+            throw std::runtime_error("Invalid number on line " + std::to_string(line_number) + " of CSV file!");
+        }
+        if (result.ec == std::errc::result_out_of_range) {
+            // stores out of range values as +-inf or 0 (like strtod) instead of failing
+            value = strtod(std::string(position, result.ptr).c_str(), nullptr);
+        }
+        row.push_back(value);
+
+        position = skip_spaces(result.ptr, end);
+        if (position < end && *position == ',') {
+            position = skip_spaces(position + 1, end);
+            // a trailing ',' doesn't start another value
+            if (!is_end_of_row(position, end)) continue;
+        }
+        if (!is_end_of_row(position, end)) {
+            throw std::runtime_error("Invalid number on line " + std::to_string(line_number) + " of CSV file!");
+        }
+        return (position < end) ? position + 1 : position;  // skips the '\n'
+    }
+}
+
+static void check_row_length(const std::vector<double> & row, std::size_t num_columns, std::size_t line_number) {
+    /* Throws if a row doesn't have a value for every column */
+
+    if (row.size() != num_columns) {
+        throw std::runtime_error(
+            "Line " + std::to_string(line_number) + " of CSV file has " + std::to_string(row.size())
+            + " values instead of " + std::to_string(num_columns) + "!"
+        );
+    }
+}
+
+static void check_first_row(const std::vector<double> & row, std::size_t first_column, std::size_t line_number) {
+    /* Throws if the first row has no values to store */
+
+    if (row.size() <= first_column) {
+        throw std::runtime_error(
+            "Line " + std::to_string(line_number) + " of CSV file has no values after column "
+            + std::to_string(first_column) + "!"
+        );
+    }
+}
+
+template <typename Sample>
+void parse_csv_rows(
+    const char * begin,
+    const char * end,
+    std::vector<std::vector<Sample>> & columns,
+    std::size_t & line_number,
+    std::size_t first_column
+) {
+    /* Parses complete rows of numbers into column vectors (the first row sets the number of columns)
+     *
+     * param begin: Pointer to the start of a row
+     * param end: Pointer one past the end of the last row (just after its '\n', or the end of the file)
+     * param columns: Column vectors that the values are appended to
+     * param line_number: Number of lines before begin (updated as rows are parsed, used for errors)
+     * param first_column: Index of the first column that is stored
+     */
+
+    std::vector<double> row;
+    const char * position = begin;
+    while (position < end) {
+        ++line_number;
+        position = parse_csv_row(position, end, row, line_number);
+        if (row.empty()) continue;
+
+        if (columns.empty()) {
+            check_first_row(row, first_column, line_number);
+            // sub-vectors for each column are created
+            for (std::size_t i = first_column; i < row.size(); ++i) {
+                columns.push_back(std::vector<Sample>(1, (Sample) row[i]));
+            }
+            continue;
+        }
+        check_row_length(row, first_column + columns.size(), line_number);
+        for (std::size_t i = first_column; i < row.size(); ++i) {
+            columns[i - first_column].push_back((Sample) row[i]);
+        }
+    }
+}
+
+template <typename Sample>
+static std::size_t parse_csv_range(
+    const char * begin,
+    const char * end,
+    std::vector<std::vector<Sample>> & columns,
+    std::size_t first_row,
+    std::size_t line_number,
+    std::size_t first_column
+) {
+    /* Parses rows straight into their place in pre-sized column vectors (one range of a parallel load)
+     *
+     * param begin: Pointer to the start of a row
+     * param end: Pointer one past the end of the range (just after a '\n', or the end of the file)
+     * param columns: Column vectors with room for every row of the range (starting at first_row)
+     * param first_row: Index of the first row of the range within the columns
+     * param line_number: Number of lines before begin (used for errors)
+     * param first_column: Index of the first column that is stored
+     * return: Number of rows parsed (blank lines are not counted)
+     */
+
+    std::vector<double> row;
+    std::size_t num_rows = 0;
+    const char * position = begin;
+    while (position < end) {
+        ++line_number;
+        position = parse_csv_row(position, end, row, line_number);
+        if (row.empty()) continue;
+
+        check_row_length(row, first_column + columns.size(), line_number);
+        for (std::size_t i = first_column; i < row.size(); ++i) {
+            columns[i - first_column][first_row + num_rows] = (Sample) row[i];
+        }
+        ++num_rows;
+    }
+    return num_rows;
+}
+
+template <typename Sample>
+std::vector<std::vector<Sample>> load_csv_file(const std::string& file_name, std::size_t first_column) {
+    /* Reads a CSV file of numbers in large blocks and parses it without any per-row allocations
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param first_column: Index of the first column that is stored (earlier columns are only checked)
+     * return: CSV file contents (one vector per column)
+     */
+
+    FILE * fp = fopen(file_name.c_str(), "rb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    std::error_code error;
+    std::uintmax_t file_size = std::filesystem::file_size(file_name, error);
+    if (error) file_size = 0;
+
+    std::vector<std::vector<Sample>> columns;
+    std::vector<char> buffer(csv_block_size);
+    std::size_t buffer_length = 0;  // bytes currently in the buffer (an unfinished row carried over + new bytes)
+    std::size_t line_number = 0;
+    bool reserved = false;
+    try {
+        while (true) {
+            // a row longer than a block makes the buffer grow
+            if (buffer_length == buffer.size()) buffer.resize(2 * buffer.size());
+            std::size_t bytes_read = fread(buffer.data() + buffer_length, 1, buffer.size() - buffer_length, fp);
+            buffer_length += bytes_read;
+            bool end_of_file = bytes_read == 0;
+
+            const char * begin = buffer.data();
+            const char * end = begin + buffer_length;
+            // only complete rows are parsed (the rest is kept for the next block)
+            const char * rows_end = end;
+            if (!end_of_file) {
+                while (rows_end > begin && rows_end[-1] != '\n') --rows_end;
+            }
+
+            std::size_t rows_before = columns.empty() ? 0 : columns[0].size();
+            parse_csv_rows(begin, rows_end, columns, line_number, first_column);
+
+            if (!reserved && !columns.empty() && rows_end > begin) {
+                // estimates the total number of rows from the first block so the columns are only allocated once
+                std::size_t newlines = std::max<std::size_t>(count_newlines(begin, rows_end), 1);
+                auto estimated_rows = (std::size_t) ((double) file_size * newlines / (double) (rows_end - begin));
+                estimated_rows += estimated_rows / 16 + rows_before;
+                for (std::vector<Sample> & column : columns) {
+                    column.reserve(std::max(estimated_rows, column.size()));
+                }
+                reserved = true;
+            }
+
+            if (end_of_file) break;
+            buffer_length = (std::size_t) (end - rows_end);
+            std::memmove(buffer.data(), rows_end, buffer_length);
+        }
+    }
+    catch (...) {
+        fclose(fp);
+        throw;
+    }
+    fclose(fp);
+    return columns;
+}
+
+template <typename Sample>
+std::vector<std::vector<Sample>> load_csv_file_parallel(
+    const std::string& file_name, int num_threads, std::size_t first_column
+) {
+    /* Reads a CSV file of numbers using several threads (the file is memory mapped and split at row boundaries)
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param num_threads: Number of threads to parse with (0 uses one per hardware thread)
+     * param first_column: Index of the first column that is stored (earlier columns are only checked)
+     * return: CSV file contents (one vector per column)
+     */
+
+    MemoryMappedFile mapped_file = MemoryMappedFile(file_name);
+    const char * begin = mapped_file.data();
+    const char * end = begin + mapped_file.size();
+    std::vector<std::vector<Sample>> columns;
+    if (begin == nullptr) return columns;
+
+    // the first row is parsed on its own to find the number of columns
+    std::vector<double> first_row;
+    std::size_t header_lines = 0;
+    const char * position = begin;
+    while (position < end && first_row.empty()) {
+        ++header_lines;
+        position = parse_csv_row(position, end, first_row, header_lines);
+    }
+    if (first_row.empty()) return columns;
+    check_first_row(first_row, first_column, header_lines);
+
+    if (num_threads <= 0) num_threads = ThreadPool::get_default_num_threads();
+    // each range should be large enough to be worth a task
+    auto max_ranges = (int) std::max<std::size_t>((std::size_t) (end - position) / (1 << 20), 1);
+    int num_ranges = std::min(num_threads, max_ranges);
+
+    // splits the rest of the file into ranges that start just after a '\n'
+    std::vector<const char *> range_starts = {position};
+    for (int i = 1; i < num_ranges; ++i) {
+        const char * split = position + (end - position) * i / num_ranges;
+        split = std::max(split, range_starts.back());
+        const char * newline = (const char *) memchr(split, '\n', (std::size_t) (end - split));
+        if (newline == nullptr) break;
+        if (newline + 1 > range_starts.back()) range_starts.push_back(newline + 1);
+    }
+    range_starts.push_back(end);
+    num_ranges = (int) range_starts.size() - 1;
+
+    ThreadPool thread_pool = ThreadPool(std::min(num_threads, num_ranges));
+
+    // the newlines in each range give an upper bound on its number of rows (blank lines don't become rows)
+    std::vector<std::size_t> newline_counts(num_ranges);
+    for (int i = 0; i < num_ranges; ++i) {
+        thread_pool.submit([&, i] {
+            newline_counts[i] = count_newlines(range_starts[i], range_starts[i + 1]);
+        });
+    }
+    thread_pool.wait();
+
+    std::vector<std::size_t> first_rows(num_ranges), first_lines(num_ranges);
+    std::size_t total_rows = 1, total_lines = header_lines;
+    for (int i = 0; i < num_ranges; ++i) {
+        first_rows[i] = total_rows;
+        first_lines[i] = total_lines;
+        // the last row of the file may not end with a '\n'
+        bool unterminated = range_starts[i + 1] > range_starts[i] && range_starts[i + 1][-1] != '\n';
+        total_rows += newline_counts[i] + (unterminated ? 1 : 0);
+        total_lines += newline_counts[i];
+    }
+
+    // every range parses into its own part of the final columns, so nothing has to be joined afterwards
+    columns.resize(first_row.size() - first_column);
+    for (std::size_t j = 0; j < columns.size(); ++j) {
+        columns[j].resize(total_rows);
+        columns[j][0] = (Sample) first_row[first_column + j];
+    }
+    std::vector<std::size_t> rows_parsed(num_ranges);
+    for (int i = 0; i < num_ranges; ++i) {
+        thread_pool.submit([&, i] {
+            rows_parsed[i] = parse_csv_range(
+                range_starts[i], range_starts[i + 1], columns, first_rows[i], first_lines[i], first_column
+            );
+        });
+    }
+    thread_pool.wait();
+
+    // blank lines leave gaps at the end of their range, which are closed up here
+    std::size_t num_rows = 1;
+    for (int i = 0; i < num_ranges; ++i) {
+        if (first_rows[i] != num_rows) {
+            for (std::vector<Sample> & column : columns) {
+                std::copy(
+                    column.begin() + (std::ptrdiff_t) first_rows[i],
+                    column.begin() + (std::ptrdiff_t) (first_rows[i] + rows_parsed[i]),
+                    column.begin() + (std::ptrdiff_t) num_rows
+                );
+            }
+        }
+        num_rows += rows_parsed[i];
+    }
+    for (std::vector<Sample> & column : columns) {
+        column.resize(num_rows);
+    }
+    return columns;
+}
+
+TimeAxis read_csv_time_axis(const std::string& file_name) {
+    /* Finds the time axis of a CSV file from the first column of its first two rows (the rest isn't read)
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * return: Time axis (start = first time, sample rate = 1 / difference between the first two times)
+     */
+
+    FILE * fp = fopen(file_name.c_str(), "rb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    const std::size_t chunk_size = 1 << 16;
+    std::vector<char> buffer;
+    std::vector<double> row, times;
+    bool end_of_file = false;
+    try {
+        // reads more of the file until two complete rows have been found
+        while (times.size() < 2 && !end_of_file) {
+            std::size_t buffer_length = buffer.size();
+            buffer.resize(buffer_length + chunk_size);
+            std::size_t bytes_read = fread(buffer.data() + buffer_length, 1, chunk_size, fp);
+            buffer.resize(buffer_length + bytes_read);
+            end_of_file = bytes_read < chunk_size;
+
+            const char * begin = buffer.data();
+            const char * end = begin + buffer.size();
+            // an unfinished row at the end of the buffer could have a cut off number
+            const char * rows_end = end;
+            if (!end_of_file) {
+                while (rows_end > begin && rows_end[-1] != '\n') --rows_end;
+            }
+
+            times.clear();
+            std::size_t line_number = 0;
+            const char * position = begin;
+            while (position < rows_end && times.size() < 2) {
+                ++line_number;
+                position = parse_csv_row(position, rows_end, row, line_number);
+                if (!row.empty()) times.push_back(row[0]);
+            }
+        }
+    }
+    catch (...) {
+        fclose(fp);
+        throw;
+    }
+    fclose(fp);
+
+    if (times.size() < 2) {
+        throw std::runtime_error("CSV file " + file_name + " needs at least 2 rows to find its sample rate!");
+    }
+    double time_step = times[1] - times[0];
+    if (!(time_step > 0.0)) {
+        throw std::runtime_error("Times in the first column of " + file_name + " must be increasing!");
+    }
+    return make_time_axis(1.0 / time_step, times[0]);
+}
+
+template void parse_csv_rows(
+    const char * begin, const char * end, std::vector<std::vector<double>> & columns, std::size_t & line_number,
+    std::size_t first_column
+);
+template void parse_csv_rows(
+    const char * begin, const char * end, std::vector<std::vector<float>> & columns, std::size_t & line_number,
+    std::size_t first_column
+);
+template std::vector<std::vector<double>> load_csv_file(const std::string& file_name, std::size_t first_column);
+template std::vector<std::vector<float>> load_csv_file(const std::string& file_name, std::size_t first_column);
+template std::vector<std::vector<double>> load_csv_file_parallel(
+    const std::string& file_name, int num_threads, std::size_t first_column
+);
+template std::vector<std::vector<float>> load_csv_file_parallel(
+    const std::string& file_name, int num_threads, std::size_t first_column
+);
+
+#endif
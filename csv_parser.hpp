@@ -0,0 +1,56 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef CSV_PARSER_HPP
+#define CSV_PARSER_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef TIME_AXIS_HPP
+#include "time_axis.hpp"
+#endif
+
+#ifndef MEMORY_MAPPED_FILE_HPP
+#include "classes/MemoryMappedFile.hpp"
+#endif
+
+#ifndef THREAD_POOL_HPP
+#include "classes/ThreadPool.hpp"
+#endif
+
+// number of bytes read from a CSV file at a time
+const std::size_t csv_block_size = 1 << 22;
+// files larger than this are parsed by several threads
+const std::size_t csv_parallel_threshold = 1 << 24;
+
+std::size_t count_newlines(const char * begin, const char * end);
+
+// columns before first_column are checked but not stored (e.g. a time column that is replaced by a TimeAxis)
+// values are always parsed as doubles, then stored as Sample (float or double)
+template <typename Sample>
+void parse_csv_rows(
+    const char * begin,
+    const char * end,
+    std::vector<std::vector<Sample>> & columns,
+    std::size_t & line_number,
+    std::size_t first_column = 0
+);
+
+template <typename Sample = double>
+std::vector<std::vector<Sample>> load_csv_file(const std::string& file_name, std::size_t first_column = 0);
+template <typename Sample = double>
+std::vector<std::vector<Sample>> load_csv_file_parallel(
+    const std::string& file_name, int num_threads = 0, std::size_t first_column = 0
+);
+
+TimeAxis read_csv_time_axis(const std::string& file_name);
+
+#endif //CSV_PARSER_HPP
@@ -0,0 +1,149 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef CSV_WRITER_HPP
+
+#include "csv_writer.hpp"
+
+// enough room for any formatted double (plus its delimiter)
+static const int max_value_length = 64;
+// std::to_chars can't print more significant figures than this usefully
+static const int max_precision = 40;
+
+template <typename Value>
+static char * format_value(char * position, Value value, int precision) {
+    /* Formats a double (or float) into a buffer that has room for max_value_length characters
+     *
+     * Floats are formatted as the exact value they hold, so they give the same digits as the equivalent double
+     * (the shortest representation is the shortest that reads back as the same float).
+     *
+     * return: Pointer just past the formatted value
+     */
+
+    std::to_chars_result result = (precision < 0)
+        ? std::to_chars(position, position + max_value_length, value)
+        : std::to_chars(position, position + max_value_length, value, std::chars_format::general, precision);
+    return result.ptr;
+}
+
+template <typename XColumn, typename Sample>
+static void write_csv_rows(
+    const std::string& file_name,
+    std::size_t num_rows,
+    XColumn x_column,
+    const std::vector<std::vector<Sample>>& y_vectors,
+    int precision
+) {
+    /* Writes rows of an x value followed by the y values (rows are formatted into a large buffer)
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param num_rows: Number of rows to write (every y vector must be at least this long)
+     * param x_column: Gives the x value of a row (from its index)
+     * param y_vectors: Other columns (e.g. one per channel)
+     * param precision: Significant figures written (csv_shortest_precision writes every double exactly)
+     */
+
+    for (const std::vector<Sample>& channel : y_vectors) {
+        if (channel.size() < num_rows) {
+            throw std::invalid_argument("Every column of a CSV file must have a value for each row!");
+        }
+    }
+    precision = std::min(precision, max_precision);
+
+    FILE * fp = fopen(file_name.c_str(), "wb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    std::size_t row_length = (y_vectors.size() + 1) * max_value_length;
+    std::vector<char> buffer(csv_write_block_size + row_length);
+    char * position = buffer.data();
+    char * flush_point = buffer.data() + csv_write_block_size;
+    bool write_failed = false;
+    for (std::size_t i = 0; i < num_rows && !write_failed; ++i) {
+        position = format_value(position, x_column(i), precision);
+        // csv file will have each channel separate
+        for (const std::vector<Sample>& channel : y_vectors) {
+            *position++ = ',';
+            position = format_value(position, channel[i], precision);
+        }
+        *position++ = '\n';
+
+        // the buffer is only written once it's full (rather than flushing every row)
+        if (position >= flush_point) {
+            auto length = (std::size_t) (position - buffer.data());
+            write_failed = fwrite(buffer.data(), 1, length, fp) != length;
+            position = buffer.data();
+        }
+    }
+    auto length = (std::size_t) (position - buffer.data());
+    if (length > 0 && !write_failed) write_failed = fwrite(buffer.data(), 1, length, fp) != length;
+
+    if (fclose(fp) != 0 || write_failed) {
+        throw std::runtime_error("Unable to write file " + file_name + "!");
+    }
+}
+
+void write_csv_columns(
+    const std::string& file_name,
+    const std::vector<double>& x_vector,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision
+) {
+    /* Writes an x column and any number of y columns to a CSV file
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param x_vector: First column (e.g. time)
+     * param y_vectors: Other columns (e.g. one per channel), each at least as long as x_vector
+     * param precision: Significant figures written (csv_shortest_precision writes every double exactly)
+     */
+
+    write_csv_rows(
+        file_name, x_vector.size(), [&x_vector](std::size_t i) { return x_vector[i]; }, y_vectors, precision
+    );
+}
+
+void write_csv_columns(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision
+) {
+    /* Writes a time column (calculated for each row, never stored) and any number of y columns to a CSV file
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param time_axis: Times of the samples (first column)
+     * param y_vectors: Other columns (e.g. one per channel), all the same length
+     * param precision: Significant figures written (csv_shortest_precision writes every double exactly)
+     */
+
+    std::size_t num_rows = y_vectors.empty() ? 0 : y_vectors[0].size();
+    write_csv_rows(
+        file_name, num_rows, [&time_axis](std::size_t i) { return get_time(time_axis, i); }, y_vectors, precision
+    );
+}
+
+void write_csv_columns(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<float>>& y_vectors,
+    int precision
+) {
+    /* Writes a time column and any number of single precision y columns to a CSV file
+     *
+     * The times are still calculated as doubles, only the y values are formatted from floats.
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param time_axis: Times of the samples (first column)
+     * param y_vectors: Other columns (e.g. one per channel), all the same length
+     * param precision: Significant figures written (csv_shortest_precision writes every float exactly)
+     */
+
+    std::size_t num_rows = y_vectors.empty() ? 0 : y_vectors[0].size();
+    write_csv_rows(
+        file_name, num_rows, [&time_axis](std::size_t i) { return get_time(time_axis, i); }, y_vectors, precision
+    );
+}
+
+#endif
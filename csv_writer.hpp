@@ -0,0 +1,47 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef CSV_WRITER_HPP
+#define CSV_WRITER_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdio>
+#include <charconv>
+#include <stdexcept>
+#include <algorithm>
+
+#ifndef TIME_AXIS_HPP
+#include "time_axis.hpp"
+#endif
+
+// matches the output of std::ostream (printf "%g" with 6 significant figures)
+const int csv_default_precision = 6;
+// writes the shortest representation that reads back as exactly the same double
+const int csv_shortest_precision = -1;
+
+// number of bytes formatted before they are written to the file
+const std::size_t csv_write_block_size = 1 << 20;
+
+void write_csv_columns(
+    const std::string& file_name,
+    const std::vector<double>& x_vector,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision = csv_default_precision
+);
+void write_csv_columns(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision = csv_default_precision
+);
+void write_csv_columns(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<float>>& y_vectors,
+    int precision = csv_default_precision
+);
+
+#endif //CSV_WRITER_HPP
@@ -63,14 +63,16 @@ tuple<vector<double>, double> generate_sine_signal(
 
 void write_csv_file(
     const string& file_name,
-    vector<double> x_vector,
-    vector<vector<double>> y_vectors
+    const vector<double>& x_vector,
+    const vector<vector<double>>& y_vectors,
+    int precision
 ) {
     /* Saves the inputted vector to a .csv file
      *
      * param file_name: Name of file
      * param x_vector: Input data used to generate sine signal (x)
      * param y_vectors: Output signal (y) - can be multiple vectors
+     * param precision: Significant figures of each value (csv_shortest_precision keeps every digit)
      */
 
     // adds .csv suffix if it doesn't already exist
@@ -79,26 +81,72 @@ void write_csv_file(
         full_file_name = file_name + ".csv";
     }
 
-    // creates a file holding the [x, y] values of the simulated tremor wave
-    ofstream csv_file(full_file_name.c_str());
+    // rows are formatted with to_chars into a large buffer, which is written in blocks
+    write_csv_columns(full_file_name, x_vector, y_vectors, precision);
+}
 
-    // crashes the program if the file cannot be opened
-    if (!csv_file.is_open()) {
-        string message = "Unable to open file " + string(full_file_name) + "!";
-        throw runtime_error(message);
-    }
+template <typename Sample>
+static void write_sampled_csv_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<Sample>>& y_vectors,
+    int precision
+) {
+    /* Saves a sampled signal (float or double) to a .csv file, see write_csv_file */
 
-    // writes values to the file
-    for (int i = 0; i < x_vector.size(); ++i) {
-        csv_file << x_vector[i];
-        // csv file will have each channel separate
-        for (auto & channel : y_vectors) {
-            csv_file << "," << channel[i];
-        }
-        csv_file << endl;
+    // adds .csv suffix if it doesn't already exist
+    string full_file_name = file_name;
+    if (file_name.substr(file_name.length() - 4, 4) != ".csv") {
+        full_file_name = file_name + ".csv";
     }
 
-    csv_file.close(); // closes file after finishing writing
+    write_csv_columns(full_file_name, time_axis, y_vectors, precision);
+}
+
+void write_csv_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<double>>& y_vectors,
+    int precision
+) {
+    /* Saves a sampled signal to a .csv file (the time of each row is calculated as it is written)
+     *
+     * param file_name: Name of file
+     * param time_axis: Start time and sample rate of the signal (x)
+     * param y_vectors: Output signal (y) - can be multiple vectors
+     * param precision: Significant figures of each value (csv_shortest_precision keeps every digit)
+     */
+
+    write_sampled_csv_file(file_name, time_axis, y_vectors, precision);
+}
+
+void write_csv_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<float>>& y_vectors,
+    int precision
+) {
+    /* Saves a single precision signal to a .csv file (the times are still calculated as doubles)
+     *
+     * param file_name: Name of file
+     * param time_axis: Start time and sample rate of the signal (x)
+     * param y_vectors: Output signal (y) - can be multiple vectors
+     * param precision: Significant figures of each value (csv_shortest_precision keeps every digit)
+     */
+
+    write_sampled_csv_file(file_name, time_axis, y_vectors, precision);
+}
+
+template <typename Sample>
+static vector<vector<Sample>> load_csv_columns(const string& full_file_name, size_t first_column) {
+    /* Loads the columns of a CSV file, starting at first_column (large files are split between threads) */
+
+    error_code size_error;
+    uintmax_t file_size = filesystem::file_size(full_file_name, size_error);
+    bool use_threads = !size_error && file_size >= csv_parallel_threshold && ThreadPool::get_default_num_threads() > 1;
+
+    if (use_threads) return load_csv_file_parallel<Sample>(full_file_name, 0, first_column);
+    return load_csv_file<Sample>(full_file_name, first_column);
 }
 
 vector<vector<double>> read_csv_file(const string& file_name) {
@@ -114,41 +162,167 @@ vector<vector<double>> read_csv_file(const string& file_name) {
         full_file_name = file_name + ".csv";
     }
 
-    // creates a file holding the [x, y] values of the simulated tremor wave
-    ifstream csv_file(full_file_name);
+    // large files are split between threads, smaller ones are read in blocks on this thread
+    vector<vector<double>> data_matrix = load_csv_columns<double>(full_file_name, 0);
+
+    return data_matrix;
+}
+
+template <typename Sample>
+tuple<vector<vector<Sample>>, TimeAxis> read_csv_signal(const string& file_name) {
+    /* Reads a signal from a CSV file whose first column is time
+     *
+     * param file_name: Name of file
+     * return: Tuple containing the signal (every column but the first, stored as Sample) and its time axis
+     */
 
-    // crashes the program if the file cannot be opened
-    if (!csv_file.is_open()) {
-        string message = "Unable to open file " + string(full_file_name) + "!";
-        throw runtime_error(message);
+    // adds .csv suffix if it doesn't already exist
+    string full_file_name = file_name;
+    if (file_name.substr(file_name.length() - 4, 4) != ".csv") {
+        full_file_name = file_name + ".csv";
     }
 
-    vector<vector<double>> data_matrix;
-    vector<double> row_vector;
-    // reads first row (to get number of columns)
-    string row_string;
-    getline(csv_file, row_string);
-
-    stringstream str(row_string);
-    string dat;
-    // splits row using ',' delimiter
-    while (getline(str, dat, ',')) {
-        // sub-vectors for each column are created
-        data_matrix.push_back({stod(dat)});
+    // only the first two times are needed for the sample rate, so the time column is never stored
+    TimeAxis time_axis = read_csv_time_axis(full_file_name);
+    vector<vector<Sample>> data_matrix = load_csv_columns<Sample>(full_file_name, 1);
+    return make_tuple(std::move(data_matrix), time_axis);
+}
+
+template <typename Sample>
+static void write_sampled_signal_file(
+    const string& file_name,
+    const vector<vector<Sample>>& y_vectors,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+) {
+    /* Saves a signal (float or double) to a binary signal (.sig) file, see write_signal_file */
+
+    // adds .sig suffix if it doesn't already exist
+    string full_file_name = file_name;
+    if (file_name.length() < 4 || file_name.substr(file_name.length() - 4, 4) != ".sig") {
+        full_file_name = file_name + ".sig";
     }
 
-    // fills the 2D vector with the rest of the data
-    while (getline(csv_file, row_string)) {
-        stringstream str_2(row_string);
-        int i = 0;
-        while (getline(str_2, dat, ',')) {
-            data_matrix[i].push_back(stod(dat));
-            ++i;
-        }
+    write_signal(full_file_name, y_vectors, sample_rate, sample_type, start_time);
+}
+
+void write_signal_file(
+    const string& file_name,
+    const vector<vector<double>>& y_vectors,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+) {
+    /* Saves the inputted vectors to a binary signal (.sig) file
+     *
+     * param file_name: Name of file
+     * param y_vectors: Signal (y) - can be multiple vectors
+     * param sample_rate: Sample rate of the signal (replaces the x column of a .csv file)
+     * param sample_type: float64_samples (exact) or float32_samples (half the size)
+     * param start_time: Time of the first sample (in seconds)
+     */
+
+    write_sampled_signal_file(file_name, y_vectors, sample_rate, sample_type, start_time);
+}
+
+void write_signal_file(
+    const string& file_name,
+    const vector<vector<float>>& y_vectors,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+) {
+    /* Saves single precision vectors to a binary signal (.sig) file (float32 samples are written without conversion)
+     *
+     * param file_name: Name of file
+     * param y_vectors: Signal (y) - can be multiple vectors
+     * param sample_rate: Sample rate of the signal (replaces the x column of a .csv file)
+     * param sample_type: float32_samples or float64_samples
+     * param start_time: Time of the first sample (in seconds)
+     */
+
+    write_sampled_signal_file(file_name, y_vectors, sample_rate, sample_type, start_time);
+}
+
+template <typename Sample>
+tuple<vector<vector<Sample>>, TimeAxis> read_signal_file(const string& file_name) {
+    /* Reads a binary signal (.sig) file
+     *
+     * param file_name: Name of file
+     * return: Tuple containing the signal (one vector per channel, stored as Sample) and its time axis (sample rate
+     *         and start time)
+     */
+
+    // adds .sig suffix if it doesn't already exist
+    string full_file_name = file_name;
+    if (file_name.length() < 4 || file_name.substr(file_name.length() - 4, 4) != ".sig") {
+        full_file_name = file_name + ".sig";
     }
-    csv_file.close();  // closes file after finishing reading
 
-    return data_matrix;
+    // samples are read straight into the vectors (no parsing)
+    SignalFileHeader header;
+    vector<vector<Sample>> data_matrix = read_signal<Sample>(full_file_name, header);
+    return make_tuple(std::move(data_matrix), make_time_axis(header.sample_rate, header.start_time));
+}
+
+template <typename Sample>
+static void write_sampled_output_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<Sample>>& y_vectors,
+    OutputFormat output_format
+) {
+    /* Saves a signal (float or double) as a .csv file or a binary .sig file, see write_output_file */
+
+    if (output_format == signal_output) {
+        // float32 keeps more significant figures than the .csv files (6), at a quarter of their size
+        write_signal_file(
+            file_name + ".sig", y_vectors, time_axis.sample_rate, float32_samples, time_axis.start
+        );
+    }
+    else {
+        write_csv_file(file_name + ".csv", time_axis, y_vectors);
+    }
+}
+
+void write_output_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<double>>& y_vectors,
+    OutputFormat output_format
+) {
+    /* Saves a signal as a .csv file or a binary .sig file
+     *
+     * param file_name: Name of file (without a suffix)
+     * param time_axis: Start time and sample rate of the signal
+     * param y_vectors: Signal (y) - can be multiple vectors
+     * param output_format: csv_output or signal_output
+     */
+
+    write_sampled_output_file(file_name, time_axis, y_vectors, output_format);
+}
+
+void write_output_file(
+    const string& file_name,
+    const TimeAxis& time_axis,
+    const vector<vector<float>>& y_vectors,
+    OutputFormat output_format
+) {
+    /* Saves a single precision signal as a .csv file or a binary .sig file (no double copy is made)
+     *
+     * param file_name: Name of file (without a suffix)
+     * param time_axis: Start time and sample rate of the signal
+     * param y_vectors: Signal (y) - can be multiple vectors
+     * param output_format: csv_output or signal_output
+     */
+
+    write_sampled_output_file(file_name, time_axis, y_vectors, output_format);
 }
 
+template tuple<vector<vector<double>>, TimeAxis> read_csv_signal(const string& file_name);
+template tuple<vector<vector<float>>, TimeAxis> read_csv_signal(const string& file_name);
+template tuple<vector<vector<double>>, TimeAxis> read_signal_file(const string& file_name);
+template tuple<vector<vector<float>>, TimeAxis> read_signal_file(const string& file_name);
+
 #endif
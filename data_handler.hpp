@@ -13,6 +13,23 @@
 #include <tuple>
 #include <string>
 #include <sstream>
+#include <filesystem>
+
+#ifndef TIME_AXIS_HPP
+#include "time_axis.hpp"
+#endif
+
+#ifndef CSV_WRITER_HPP
+#include "csv_writer.hpp"
+#endif
+
+#ifndef SIGNAL_FILE_HPP
+#include "signal_file.hpp"
+#endif
+
+#ifndef CSV_PARSER_HPP
+#include "csv_parser.hpp"
+#endif
 
 std::tuple<std::vector<double>, double> generate_sine_signal(
     std::vector<double> frequencies,
@@ -25,9 +42,58 @@ std::tuple<std::vector<double>, double> generate_sine_signal(
 
 void write_csv_file(
     const std::string& file_name,
-    std::vector<double> x_vector,
-    std::vector<std::vector<double>> y_vectors
+    const std::vector<double>& x_vector,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision = csv_default_precision
+);
+void write_csv_file(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<double>>& y_vectors,
+    int precision = csv_default_precision
+);
+void write_csv_file(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<float>>& y_vectors,
+    int precision = csv_default_precision
 );
 std::vector<std::vector<double>> read_csv_file(const std::string& file_name);
+// signals are read as doubles unless float is chosen (read_csv_signal<float> never holds a double copy)
+template <typename Sample = double>
+std::tuple<std::vector<std::vector<Sample>>, TimeAxis> read_csv_signal(const std::string& file_name);
+
+void write_signal_file(
+    const std::string& file_name,
+    const std::vector<std::vector<double>>& y_vectors,
+    double sample_rate,
+    SampleType sample_type = float64_samples,
+    double start_time = 0.0
+);
+void write_signal_file(
+    const std::string& file_name,
+    const std::vector<std::vector<float>>& y_vectors,
+    double sample_rate,
+    SampleType sample_type = float32_samples,
+    double start_time = 0.0
+);
+template <typename Sample = double>
+std::tuple<std::vector<std::vector<Sample>>, TimeAxis> read_signal_file(const std::string& file_name);
+
+/* Formats that signals can be saved in */
+enum OutputFormat { csv_output, signal_output };
+
+void write_output_file(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<double>>& y_vectors,
+    OutputFormat output_format
+);
+void write_output_file(
+    const std::string& file_name,
+    const TimeAxis& time_axis,
+    const std::vector<std::vector<float>>& y_vectors,
+    OutputFormat output_format
+);
 
 #endif //DATA_HANDLER_HPP
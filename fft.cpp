@@ -0,0 +1,288 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FFT_HPP
+
+#include "fft.hpp"
+
+template <typename Sample>
+BasicFFTPlan<Sample>::BasicFFTPlan() {
+    /* Empty plan (size 0) */
+
+    fft_size = 0;
+}
+
+template <typename Sample>
+BasicFFTPlan<Sample>::BasicFFTPlan(int fft_size) {
+    /* FFT plan constructor
+     *
+     * param fft_size: Number of points in the transform (must be a power of 2)
+     */
+
+    if (fft_size < 1 || (fft_size & (fft_size - 1)) != 0) {
+        throw std::runtime_error("FFT size must be a power of 2!");
+    }
+    this->fft_size = fft_size;
+
+    // twiddle factors are calculated once here instead of once per butterfly
+    twiddle_factors.resize(fft_size / 2);
+    for (int k = 0; k < fft_size / 2; ++k) {
+        twiddle_factors[k] = std::complex<Sample>(std::polar(1.0, -2.0 * M_PI * k / fft_size));
+    }
+
+    int num_bits = 0;
+    while ((1 << num_bits) < fft_size) {
+        ++num_bits;
+    }
+    // reverses the bits of each index (e.g. 001 -> 100 for an 8 point FFT)
+    bit_reverse_table.resize(fft_size);
+    for (int i = 0; i < fft_size; ++i) {
+        int reversed = 0;
+        for (int bit = 0; bit < num_bits; ++bit) {
+            reversed |= ((i >> bit) & 1) << (num_bits - 1 - bit);
+        }
+        bit_reverse_table[i] = reversed;
+    }
+}
+
+template <typename Sample>
+void BasicFFTPlan<Sample>::transform(std::complex<Sample> * data, bool inverse) const {
+    /* Applies an iterative in-place radix-2 FFT (no memory is allocated)
+     *
+     * param data: Pointer to fft_size complex values (overwritten by the transform)
+     * param inverse: Uses conjugated twiddle factors and divides the result by fft_size if true
+     */
+
+    int N = fft_size;
+
+    // reorders the data so the butterflies can work in place
+    for (int i = 0; i < N; ++i) {
+        int j = bit_reverse_table[i];
+        if (i < j) std::swap(data[i], data[j]);
+    }
+
+    // combines pairs, then groups of 4, 8 etc. until the full transform is done
+    Sample sign = inverse ? -1 : 1;
+    for (int length = 2; length <= N; length *= 2) {
+        int half_length = length / 2;
+        int twiddle_step = N / length;
+        for (int start = 0; start < N; start += length) {
+            for (int k = 0; k < half_length; ++k) {
+                const std::complex<Sample> & w = twiddle_factors[k * twiddle_step];
+                Sample w_real = w.real();
+                Sample w_imag = sign * w.imag();
+
+                std::complex<Sample> & even = data[start + k];
+                std::complex<Sample> & odd = data[start + k + half_length];
+                // complex multiply is written out to avoid the slow NaN handling of std::complex
+                Sample t_real = w_real * odd.real() - w_imag * odd.imag();
+                Sample t_imag = w_real * odd.imag() + w_imag * odd.real();
+                odd = std::complex<Sample>(even.real() - t_real, even.imag() - t_imag);
+                even = std::complex<Sample>(even.real() + t_real, even.imag() + t_imag);
+            }
+        }
+    }
+
+    if (inverse) {
+        Sample scale = Sample(1.0 / N);
+        for (int i = 0; i < N; ++i) {
+            data[i] *= scale;
+        }
+    }
+}
+
+template <typename Sample>
+int BasicFFTPlan<Sample>::get_size() const {
+    /*
+     * return: Number of points in the transform
+     */
+    return fft_size;
+}
+
+template <typename Sample>
+BasicRealFFTPlan<Sample>::BasicRealFFTPlan() {
+    /* Empty plan (size 0) */
+
+    fft_size = 0;
+}
+
+template <typename Sample>
+BasicRealFFTPlan<Sample>::BasicRealFFTPlan(int fft_size) {
+    /* Real FFT plan constructor
+     *
+     * param fft_size: Number of real points in the transform (must be a power of 2 and at least 2)
+     */
+
+    if (fft_size < 2 || (fft_size & (fft_size - 1)) != 0) {
+        throw std::runtime_error("Real FFT size must be a power of 2 (at least 2)!");
+    }
+    this->fft_size = fft_size;
+    half_plan = BasicFFTPlan<Sample>(fft_size / 2);
+
+    // only the first quarter is needed as bins k and N / 2 - k are calculated together
+    twiddle_factors.resize(fft_size / 4 + 1);
+    for (int k = 0; k <= fft_size / 4; ++k) {
+        twiddle_factors[k] = std::complex<Sample>(std::polar(1.0, -2.0 * M_PI * k / fft_size));
+    }
+}
+
+template <typename Sample>
+void BasicRealFFTPlan<Sample>::forward(const Sample * input, std::complex<Sample> * output) const {
+    /* Transforms real data into its non-negative frequency bins (no memory is allocated)
+     *
+     * param input: Pointer to fft_size real values
+     * param output: Pointer to fft_size / 2 + 1 complex values that receive bins 0 to N / 2
+     */
+
+    int M = fft_size / 2;
+    const Sample half = 0.5;
+
+    // even samples become the real parts and odd samples become the imaginary parts
+    for (int i = 0; i < M; ++i) {
+        output[i] = std::complex<Sample>(input[2 * i], input[2 * i + 1]);
+    }
+    half_plan.transform(output, false);
+
+    // separates the spectra of the even (E) and odd (O) samples, then X[k] = E[k] + W^k * O[k]
+    std::complex<Sample> z_0 = output[0];
+    output[0] = std::complex<Sample>(z_0.real() + z_0.imag(), 0.0);
+    output[M] = std::complex<Sample>(z_0.real() - z_0.imag(), 0.0);
+    for (int k = 1; k <= M / 2; ++k) {
+        std::complex<Sample> z_k = output[k];
+        std::complex<Sample> z_m_k = std::conj(output[M - k]);
+        Sample e_real = half * (z_k.real() + z_m_k.real());
+        Sample e_imag = half * (z_k.imag() + z_m_k.imag());
+        // O[k] = (Z[k] - conj(Z[M - k])) / 2i
+        Sample o_real = half * (z_k.imag() - z_m_k.imag());
+        Sample o_imag = -half * (z_k.real() - z_m_k.real());
+
+        const std::complex<Sample> & w = twiddle_factors[k];
+        Sample t_real = w.real() * o_real - w.imag() * o_imag;
+        Sample t_imag = w.real() * o_imag + w.imag() * o_real;
+
+        // X[M - k] = conj(E[k] - W^k * O[k])
+        output[k] = std::complex<Sample>(e_real + t_real, e_imag + t_imag);
+        output[M - k] = std::complex<Sample>(e_real - t_real, t_imag - e_imag);
+    }
+}
+
+template <typename Sample>
+void BasicRealFFTPlan<Sample>::inverse(std::complex<Sample> * input, Sample * output) const {
+    /* Transforms non-negative frequency bins back into real data (normalised, no memory is allocated)
+     *
+     * param input: Pointer to fft_size / 2 + 1 complex bins (overwritten during the transform)
+     * param output: Pointer to fft_size real values that receive the signal
+     */
+
+    int M = fft_size / 2;
+    const Sample half = 0.5;
+
+    // rebuilds the spectrum of the packed signal, Z[k] = E[k] + i * O[k]
+    Sample x_0 = input[0].real();
+    Sample x_m = input[M].real();
+    input[0] = std::complex<Sample>(half * (x_0 + x_m), half * (x_0 - x_m));
+    for (int k = 1; k <= M / 2; ++k) {
+        std::complex<Sample> x_k = input[k];
+        std::complex<Sample> x_m_k = std::conj(input[M - k]);
+        Sample e_real = half * (x_k.real() + x_m_k.real());
+        Sample e_imag = half * (x_k.imag() + x_m_k.imag());
+        Sample d_real = half * (x_k.real() - x_m_k.real());
+        Sample d_imag = half * (x_k.imag() - x_m_k.imag());
+
+        // O[k] = (X[k] - conj(X[M - k])) * conj(W^k) / 2
+        const std::complex<Sample> & w = twiddle_factors[k];
+        Sample o_real = d_real * w.real() + d_imag * w.imag();
+        Sample o_imag = d_imag * w.real() - d_real * w.imag();
+
+        // Z[M - k] = conj(E[k]) + i * conj(O[k])
+        input[k] = std::complex<Sample>(e_real - o_imag, e_imag + o_real);
+        input[M - k] = std::complex<Sample>(e_real + o_imag, o_real - e_imag);
+    }
+    half_plan.transform(input, true);
+
+    // unpacks the even and odd samples
+    for (int i = 0; i < M; ++i) {
+        output[2 * i] = input[i].real();
+        output[2 * i + 1] = input[i].imag();
+    }
+}
+
+template <typename Sample>
+int BasicRealFFTPlan<Sample>::get_size() const {
+    /*
+     * return: Number of real points in the transform
+     */
+    return fft_size;
+}
+
+template <typename Sample>
+int BasicRealFFTPlan<Sample>::get_num_bins() const {
+    /*
+     * return: Number of complex frequency bins produced by the transform (N / 2 + 1)
+     */
+    return fft_size / 2 + 1;
+}
+
+template <typename Sample>
+void fft(std::complex<Sample> * data, const BasicFFTPlan<Sample>& plan) {
+    /* Applies a fast fourier transform to the data in place
+     *
+     * param data: Pointer to plan.get_size() complex values
+     * param plan: Precomputed tables for the transform size
+     */
+
+    plan.transform(data, false);
+}
+
+template <typename Sample>
+void inv_fft(std::complex<Sample> * data, const BasicFFTPlan<Sample>& plan) {
+    /* Applies an inverse fast fourier transform to the data in place (normalised by the transform size)
+     *
+     * param data: Pointer to plan.get_size() complex values
+     * param plan: Precomputed tables for the transform size
+     */
+
+    plan.transform(data, true);
+}
+
+template <typename Sample>
+void real_fft(const Sample * input, std::complex<Sample> * output, const BasicRealFFTPlan<Sample>& plan) {
+    /* Applies a fast fourier transform to real data
+     *
+     * param input: Pointer to plan.get_size() real values
+     * param output: Pointer to plan.get_num_bins() complex values that receive the spectrum
+     * param plan: Precomputed tables for the transform size
+     */
+
+    plan.forward(input, output);
+}
+
+template <typename Sample>
+void inv_real_fft(std::complex<Sample> * input, Sample * output, const BasicRealFFTPlan<Sample>& plan) {
+    /* Applies an inverse fast fourier transform that produces real data (normalised by the transform size)
+     *
+     * param input: Pointer to plan.get_num_bins() complex values (overwritten during the transform)
+     * param output: Pointer to plan.get_size() real values that receive the signal
+     * param plan: Precomputed tables for the transform size
+     */
+
+    plan.inverse(input, output);
+}
+
+// the plans and transforms are compiled for both precisions here (so the definitions can stay out of the header)
+template class BasicFFTPlan<double>;
+template class BasicFFTPlan<float>;
+template class BasicRealFFTPlan<double>;
+template class BasicRealFFTPlan<float>;
+
+template void fft(std::complex<double> * data, const BasicFFTPlan<double>& plan);
+template void fft(std::complex<float> * data, const BasicFFTPlan<float>& plan);
+template void inv_fft(std::complex<double> * data, const BasicFFTPlan<double>& plan);
+template void inv_fft(std::complex<float> * data, const BasicFFTPlan<float>& plan);
+template void real_fft(const double * input, std::complex<double> * output, const BasicRealFFTPlan<double>& plan);
+template void real_fft(const float * input, std::complex<float> * output, const BasicRealFFTPlan<float>& plan);
+template void inv_real_fft(std::complex<double> * input, double * output, const BasicRealFFTPlan<double>& plan);
+template void inv_real_fft(std::complex<float> * input, float * output, const BasicRealFFTPlan<float>& plan);
+
+#endif
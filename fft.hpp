@@ -0,0 +1,71 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FFT_HPP
+#define FFT_HPP
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <stdexcept>
+
+template <typename Sample>
+class BasicFFTPlan {
+    /* Precomputed tables for a radix-2 FFT of a fixed size (reusable and never modified by a transform)
+     *
+     * Sample is the precision of the data (float or double), the tables are always calculated in double precision.
+     */
+
+    private:
+        int fft_size;
+        std::vector<std::complex<Sample>> twiddle_factors;  // e^(-2 * PI * i * k / N) for k < N / 2
+        std::vector<int> bit_reverse_table;  // index that each element is swapped with before the butterflies
+
+    public:
+        BasicFFTPlan();
+        explicit BasicFFTPlan(int fft_size);
+
+        void transform(std::complex<Sample> * data, bool inverse) const;
+
+        int get_size() const;
+};
+
+template <typename Sample>
+class BasicRealFFTPlan {
+    /* Precomputed tables for a real input FFT (packs N real values into an N / 2 point complex FFT) */
+
+    private:
+        int fft_size;
+        BasicFFTPlan<Sample> half_plan;
+        std::vector<std::complex<Sample>> twiddle_factors;  // e^(-2 * PI * i * k / N) for k <= N / 4
+
+    public:
+        BasicRealFFTPlan();
+        explicit BasicRealFFTPlan(int fft_size);
+
+        void forward(const Sample * input, std::complex<Sample> * output) const;
+        void inverse(std::complex<Sample> * input, Sample * output) const;
+
+        int get_size() const;
+        int get_num_bins() const;
+};
+
+// plans are instantiated for double and float (fft.cpp)
+typedef BasicFFTPlan<double> FFTPlan;
+typedef BasicFFTPlan<float> FloatFFTPlan;
+typedef BasicRealFFTPlan<double> RealFFTPlan;
+typedef BasicRealFFTPlan<float> FloatRealFFTPlan;
+
+template <typename Sample>
+void fft(std::complex<Sample> * data, const BasicFFTPlan<Sample>& plan);
+template <typename Sample>
+void inv_fft(std::complex<Sample> * data, const BasicFFTPlan<Sample>& plan);
+
+template <typename Sample>
+void real_fft(const Sample * input, std::complex<Sample> * output, const BasicRealFFTPlan<Sample>& plan);
+template <typename Sample>
+void inv_real_fft(std::complex<Sample> * input, Sample * output, const BasicRealFFTPlan<Sample>& plan);
+
+#endif //FFT_HPP
@@ -0,0 +1,1316 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FIR_KERNELS_HPP
+
+#include "fir_kernels.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FIR_KERNELS_X86_64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+// MSVC allows any intrinsic without changing the compiler flags
+#define TARGET_AVX2
+#define TARGET_AVX512
+#else
+// only these functions are compiled for the newer instruction sets (selected at runtime)
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+#endif
+
+typedef double (*DotProductKernel)(const double * a, const double * b, int length);
+typedef void (*FirBlockKernel)(const double * c, int num_coefficients, const double * x, double * y, int num_outputs);
+typedef void (*FoldedFirBlockKernel)(
+    const double * c, int num_coefficients, bool antisymmetric, const double * x, double * y, int num_outputs
+);
+typedef void (*FloatFirBlockKernel)(const float * c, int num_coefficients, const float * x, float * y, int num_outputs);
+typedef void (*FloatFoldedFirBlockKernel)(
+    const float * c, int num_coefficients, bool antisymmetric, const float * x, float * y, int num_outputs
+);
+typedef void (*Q15FirBlockKernel)(
+    const Q15Coefficients& coefficients, const signed short * x, signed short * y, int num_outputs
+);
+
+template <typename Sample>
+static Sample dot_product_scalar(const Sample * a, const Sample * b, int length) {
+    /* Portable kernel (4 independent sums so the additions can overlap) */
+
+    Sample sum_0 = 0, sum_1 = 0, sum_2 = 0, sum_3 = 0;
+    int i = 0;
+    for (; i + 4 <= length; i += 4) {
+        sum_0 += a[i] * b[i];
+        sum_1 += a[i + 1] * b[i + 1];
+        sum_2 += a[i + 2] * b[i + 2];
+        sum_3 += a[i + 3] * b[i + 3];
+    }
+    for (; i < length; ++i) {
+        sum_0 += a[i] * b[i];
+    }
+    return (sum_0 + sum_1) + (sum_2 + sum_3);
+}
+
+template <typename Sample>
+static void fir_block_scalar(const Sample * c, int num_coefficients, const Sample * x, Sample * y, int num_outputs) {
+    /* Portable block kernel (one dot product per output) */
+
+    for (int i = 0; i < num_outputs; ++i) {
+        y[i] = dot_product_scalar(c, x + i, num_coefficients);
+    }
+}
+
+template <typename Sample>
+static Sample folded_output(const Sample * c, int num_coefficients, bool antisymmetric, const Sample * x) {
+    /* Calculates a single output of a folded FIR (used for the outputs left over by the SIMD kernels) */
+
+    int half_length = num_coefficients / 2;
+    Sample result = (num_coefficients % 2 == 1) ? c[half_length] * x[half_length] : 0;
+    const Sample * x_end = x + num_coefficients - 1;
+    if (antisymmetric) {
+        for (int j = 0; j < half_length; ++j) result += c[j] * (x[j] - x_end[-j]);
+    }
+    else {
+        for (int j = 0; j < half_length; ++j) result += c[j] * (x[j] + x_end[-j]);
+    }
+    return result;
+}
+
+template <typename Sample>
+static void fir_block_folded_scalar(
+    const Sample * c, int num_coefficients, bool antisymmetric, const Sample * x, Sample * y, int num_outputs
+) {
+    /* Portable folded block kernel (4 neighbouring outputs at a time so the additions can overlap) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    Sample sign = antisymmetric ? -1 : 1;
+    int i = 0;
+    for (; i + 4 <= num_outputs; i += 4) {
+        Sample sum_0 = 0, sum_1 = 0, sum_2 = 0, sum_3 = 0;
+        const Sample * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            Sample coefficient = c[j];
+            const Sample * head = window + j;
+            const Sample * tail = window + last - j;
+            sum_0 += coefficient * (head[0] + sign * tail[0]);
+            sum_1 += coefficient * (head[1] + sign * tail[1]);
+            sum_2 += coefficient * (head[2] + sign * tail[2]);
+            sum_3 += coefficient * (head[3] + sign * tail[3]);
+        }
+        if (num_coefficients % 2 == 1) {
+            Sample coefficient = c[half_length];
+            sum_0 += coefficient * window[half_length];
+            sum_1 += coefficient * window[half_length + 1];
+            sum_2 += coefficient * window[half_length + 2];
+            sum_3 += coefficient * window[half_length + 3];
+        }
+        y[i] = sum_0;
+        y[i + 1] = sum_1;
+        y[i + 2] = sum_2;
+        y[i + 3] = sum_3;
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = folded_output(c, num_coefficients, antisymmetric, x + i);
+    }
+}
+
+static signed short round_q15_output(long long sum, int shift) {
+    /* Rounds a fixed point sum to the nearest integer (halves up) and saturates it to the int16 range */
+
+    if (shift > 0) sum = (sum + (1LL << (shift - 1))) >> shift;
+    return (signed short) std::min<long long>(std::max<long long>(sum, -32768), 32767);
+}
+
+static std::vector<int> make_q15_coefficient_pairs(const signed short * c, int num_coefficients) {
+    /* Packs neighbouring coefficients into 32 bit pairs for pmaddwd (c_j in the low half, c_(j+1) in the high half)
+     *
+     * An odd last coefficient is paired with 0.
+     */
+
+    std::vector<int> pairs((num_coefficients + 1) / 2);
+    for (int j = 0; j < num_coefficients; j += 2) {
+        int high = (j + 1 < num_coefficients) ? c[j + 1] : 0;
+        pairs[j / 2] = (int) ((unsigned int) (unsigned short) c[j] | ((unsigned int) (unsigned short) high << 16));
+    }
+    return pairs;
+}
+
+static std::vector<int> make_q15_pair_groups(const signed short * c, int num_coefficients, int shift) {
+    /* Splits the coefficient pairs into groups whose 32 bit sums (plus rounding) can't overflow
+     *
+     * The largest possible sum is sum{j}(|c_j|) * 32768 (every input at -32768 with the sign of its coefficient).
+     * Most filters need a single group, otherwise the group sums are added in 64 bits.
+     *
+     * return: Index of the pair after the end of each group
+     */
+
+    long long limit = INT_MAX - (shift > 0 ? 1LL << (shift - 1) : 0);
+    std::vector<int> group_ends;
+    long long largest_sum = 0;
+    int num_pairs = (num_coefficients + 1) / 2;
+    for (int p = 0; p < num_pairs; ++p) {
+        long long largest_pair_sum = 32768LL * std::abs((int) c[2 * p]);
+        if (2 * p + 1 < num_coefficients) largest_pair_sum += 32768LL * std::abs((int) c[2 * p + 1]);
+        if (largest_sum + largest_pair_sum > limit) {
+            group_ends.push_back(p);
+            largest_sum = 0;
+        }
+        largest_sum += largest_pair_sum;
+    }
+    group_ends.push_back(num_pairs);
+    return group_ends;
+}
+
+static void fir_block_q15_scalar(
+    const Q15Coefficients& coefficients, const signed short * x, signed short * y, int num_outputs
+) {
+    /* Portable fixed point block kernel (64 bit sums, so it never overflows) */
+
+    const signed short * c = coefficients.reversed_coefficients.data();
+    auto num_coefficients = (int) coefficients.reversed_coefficients.size();
+    int shift = coefficients.shift;
+    for (int i = 0; i < num_outputs; ++i) {
+        long long sum = 0;
+        for (int j = 0; j < num_coefficients; ++j) {
+            sum += c[j] * x[i + j];
+        }
+        y[i] = round_q15_output(sum, shift);
+    }
+}
+
+#ifdef FIR_KERNELS_X86_64
+
+static double dot_product_sse2(const double * a, const double * b, int length) {
+    /* SSE2 kernel (2 doubles per register, 4 accumulators) */
+
+    __m128d sum_0 = _mm_setzero_pd(), sum_1 = _mm_setzero_pd();
+    __m128d sum_2 = _mm_setzero_pd(), sum_3 = _mm_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= length; i += 8) {
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+        sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(_mm_loadu_pd(a + i + 4), _mm_loadu_pd(b + i + 4)));
+        sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(_mm_loadu_pd(a + i + 6), _mm_loadu_pd(b + i + 6)));
+    }
+    for (; i + 2 <= length; i += 2) {
+        sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+    }
+    __m128d sum = _mm_add_pd(_mm_add_pd(sum_0, sum_1), _mm_add_pd(sum_2, sum_3));
+    double result = _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    for (; i < length; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+TARGET_AVX2 static double dot_product_avx2(const double * a, const double * b, int length) {
+    /* AVX2 + FMA kernel (4 doubles per register, 4 accumulators hide the FMA latency) */
+
+    __m256d sum_0 = _mm256_setzero_pd(), sum_1 = _mm256_setzero_pd();
+    __m256d sum_2 = _mm256_setzero_pd(), sum_3 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 16 <= length; i += 16) {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), sum_1);
+        sum_2 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 8), _mm256_loadu_pd(b + i + 8), sum_2);
+        sum_3 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 12), _mm256_loadu_pd(b + i + 12), sum_3);
+    }
+    for (; i + 4 <= length; i += 4) {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum_0);
+    }
+    __m256d sum = _mm256_add_pd(_mm256_add_pd(sum_0, sum_1), _mm256_add_pd(sum_2, sum_3));
+    __m128d half_sum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    double result = _mm_cvtsd_f64(_mm_add_sd(half_sum, _mm_unpackhi_pd(half_sum, half_sum)));
+    for (; i < length; ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+TARGET_AVX512 static double dot_product_avx512(const double * a, const double * b, int length) {
+    /* AVX-512 kernel (8 doubles per register, 4 accumulators, masked tail) */
+
+    __m512d sum_0 = _mm512_setzero_pd(), sum_1 = _mm512_setzero_pd();
+    __m512d sum_2 = _mm512_setzero_pd(), sum_3 = _mm512_setzero_pd();
+    int i = 0;
+    for (; i + 32 <= length; i += 32) {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum_0);
+        sum_1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), sum_1);
+        sum_2 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 16), _mm512_loadu_pd(b + i + 16), sum_2);
+        sum_3 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 24), _mm512_loadu_pd(b + i + 24), sum_3);
+    }
+    for (; i + 8 <= length; i += 8) {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum_0);
+    }
+    if (i < length) {
+        // masked loads read 0 for the elements past the end
+        __mmask8 mask = (__mmask8) ((1u << (length - i)) - 1u);
+        sum_1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i), sum_1);
+    }
+    __m512d sum = _mm512_add_pd(_mm512_add_pd(sum_0, sum_1), _mm512_add_pd(sum_2, sum_3));
+    return _mm512_reduce_add_pd(sum);
+}
+
+static void fir_block_sse2(const double * c, int num_coefficients, const double * x, double * y, int num_outputs) {
+    /* SSE2 block kernel (8 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 8 <= num_outputs; i += 8) {
+        __m128d sum_0 = _mm_setzero_pd(), sum_1 = _mm_setzero_pd();
+        __m128d sum_2 = _mm_setzero_pd(), sum_3 = _mm_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m128d coefficient = _mm_set1_pd(c[j]);
+            sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(coefficient, _mm_loadu_pd(window + j)));
+            sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(coefficient, _mm_loadu_pd(window + j + 2)));
+            sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(coefficient, _mm_loadu_pd(window + j + 4)));
+            sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(coefficient, _mm_loadu_pd(window + j + 6)));
+        }
+        _mm_storeu_pd(y + i, sum_0);
+        _mm_storeu_pd(y + i + 2, sum_1);
+        _mm_storeu_pd(y + i + 4, sum_2);
+        _mm_storeu_pd(y + i + 6, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = dot_product_sse2(c, x + i, num_coefficients);
+    }
+}
+
+TARGET_AVX2 static void fir_block_avx2(const double * c, int num_coefficients, const double * x, double * y, int num_outputs) {
+    /* AVX2 + FMA block kernel (16 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 16 <= num_outputs; i += 16) {
+        __m256d sum_0 = _mm256_setzero_pd(), sum_1 = _mm256_setzero_pd();
+        __m256d sum_2 = _mm256_setzero_pd(), sum_3 = _mm256_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m256d coefficient = _mm256_broadcast_sd(c + j);
+            sum_0 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + j), sum_0);
+            sum_1 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + j + 4), sum_1);
+            sum_2 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + j + 8), sum_2);
+            sum_3 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + j + 12), sum_3);
+        }
+        _mm256_storeu_pd(y + i, sum_0);
+        _mm256_storeu_pd(y + i + 4, sum_1);
+        _mm256_storeu_pd(y + i + 8, sum_2);
+        _mm256_storeu_pd(y + i + 12, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = dot_product_avx2(c, x + i, num_coefficients);
+    }
+}
+
+TARGET_AVX512 static void fir_block_avx512(const double * c, int num_coefficients, const double * x, double * y, int num_outputs) {
+    /* AVX-512 block kernel (32 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 32 <= num_outputs; i += 32) {
+        __m512d sum_0 = _mm512_setzero_pd(), sum_1 = _mm512_setzero_pd();
+        __m512d sum_2 = _mm512_setzero_pd(), sum_3 = _mm512_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m512d coefficient = _mm512_set1_pd(c[j]);
+            sum_0 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + j), sum_0);
+            sum_1 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + j + 8), sum_1);
+            sum_2 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + j + 16), sum_2);
+            sum_3 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + j + 24), sum_3);
+        }
+        _mm512_storeu_pd(y + i, sum_0);
+        _mm512_storeu_pd(y + i + 8, sum_1);
+        _mm512_storeu_pd(y + i + 16, sum_2);
+        _mm512_storeu_pd(y + i + 24, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = dot_product_avx512(c, x + i, num_coefficients);
+    }
+}
+
+static void fir_block_folded_sse2(
+    const double * c, int num_coefficients, bool antisymmetric, const double * x, double * y, int num_outputs
+) {
+    /* SSE2 folded block kernel (8 neighbouring outputs, 4 accumulators) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    int i = 0;
+    for (; i + 8 <= num_outputs; i += 8) {
+        __m128d sum_0 = _mm_setzero_pd(), sum_1 = _mm_setzero_pd();
+        __m128d sum_2 = _mm_setzero_pd(), sum_3 = _mm_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m128d coefficient = _mm_set1_pd(c[j]);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m128d folded_0, folded_1, folded_2, folded_3;
+            if (antisymmetric) {
+                folded_0 = _mm_sub_pd(_mm_loadu_pd(window + j), _mm_loadu_pd(window + last - j));
+                folded_1 = _mm_sub_pd(_mm_loadu_pd(window + j + 2), _mm_loadu_pd(window + last - j + 2));
+                folded_2 = _mm_sub_pd(_mm_loadu_pd(window + j + 4), _mm_loadu_pd(window + last - j + 4));
+                folded_3 = _mm_sub_pd(_mm_loadu_pd(window + j + 6), _mm_loadu_pd(window + last - j + 6));
+            }
+            else {
+                folded_0 = _mm_add_pd(_mm_loadu_pd(window + j), _mm_loadu_pd(window + last - j));
+                folded_1 = _mm_add_pd(_mm_loadu_pd(window + j + 2), _mm_loadu_pd(window + last - j + 2));
+                folded_2 = _mm_add_pd(_mm_loadu_pd(window + j + 4), _mm_loadu_pd(window + last - j + 4));
+                folded_3 = _mm_add_pd(_mm_loadu_pd(window + j + 6), _mm_loadu_pd(window + last - j + 6));
+            }
+            sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(coefficient, folded_0));
+            sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(coefficient, folded_1));
+            sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(coefficient, folded_2));
+            sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(coefficient, folded_3));
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m128d coefficient = _mm_set1_pd(c[half_length]);
+            sum_0 = _mm_add_pd(sum_0, _mm_mul_pd(coefficient, _mm_loadu_pd(window + half_length)));
+            sum_1 = _mm_add_pd(sum_1, _mm_mul_pd(coefficient, _mm_loadu_pd(window + half_length + 2)));
+            sum_2 = _mm_add_pd(sum_2, _mm_mul_pd(coefficient, _mm_loadu_pd(window + half_length + 4)));
+            sum_3 = _mm_add_pd(sum_3, _mm_mul_pd(coefficient, _mm_loadu_pd(window + half_length + 6)));
+        }
+        _mm_storeu_pd(y + i, sum_0);
+        _mm_storeu_pd(y + i + 2, sum_1);
+        _mm_storeu_pd(y + i + 4, sum_2);
+        _mm_storeu_pd(y + i + 6, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = folded_output(c, num_coefficients, antisymmetric, x + i);
+    }
+}
+
+TARGET_AVX2 static void fir_block_folded_avx2(
+    const double * c, int num_coefficients, bool antisymmetric, const double * x, double * y, int num_outputs
+) {
+    /* AVX2 + FMA folded block kernel (16 neighbouring outputs, 4 accumulators) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    // subtracting is done by flipping the sign bit of the second input
+    __m256d sign = antisymmetric ? _mm256_set1_pd(-0.0) : _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 16 <= num_outputs; i += 16) {
+        __m256d sum_0 = _mm256_setzero_pd(), sum_1 = _mm256_setzero_pd();
+        __m256d sum_2 = _mm256_setzero_pd(), sum_3 = _mm256_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m256d coefficient = _mm256_broadcast_sd(c + j);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m256d folded_0 = _mm256_add_pd(
+                _mm256_loadu_pd(window + j), _mm256_xor_pd(_mm256_loadu_pd(window + last - j), sign)
+            );
+            __m256d folded_1 = _mm256_add_pd(
+                _mm256_loadu_pd(window + j + 4), _mm256_xor_pd(_mm256_loadu_pd(window + last - j + 4), sign)
+            );
+            __m256d folded_2 = _mm256_add_pd(
+                _mm256_loadu_pd(window + j + 8), _mm256_xor_pd(_mm256_loadu_pd(window + last - j + 8), sign)
+            );
+            __m256d folded_3 = _mm256_add_pd(
+                _mm256_loadu_pd(window + j + 12), _mm256_xor_pd(_mm256_loadu_pd(window + last - j + 12), sign)
+            );
+            sum_0 = _mm256_fmadd_pd(coefficient, folded_0, sum_0);
+            sum_1 = _mm256_fmadd_pd(coefficient, folded_1, sum_1);
+            sum_2 = _mm256_fmadd_pd(coefficient, folded_2, sum_2);
+            sum_3 = _mm256_fmadd_pd(coefficient, folded_3, sum_3);
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m256d coefficient = _mm256_broadcast_sd(c + half_length);
+            sum_0 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + half_length), sum_0);
+            sum_1 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + half_length + 4), sum_1);
+            sum_2 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + half_length + 8), sum_2);
+            sum_3 = _mm256_fmadd_pd(coefficient, _mm256_loadu_pd(window + half_length + 12), sum_3);
+        }
+        _mm256_storeu_pd(y + i, sum_0);
+        _mm256_storeu_pd(y + i + 4, sum_1);
+        _mm256_storeu_pd(y + i + 8, sum_2);
+        _mm256_storeu_pd(y + i + 12, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = folded_output(c, num_coefficients, antisymmetric, x + i);
+    }
+}
+
+TARGET_AVX512 static void fir_block_folded_avx512(
+    const double * c, int num_coefficients, bool antisymmetric, const double * x, double * y, int num_outputs
+) {
+    /* AVX-512 folded block kernel (32 neighbouring outputs, 4 accumulators) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    // the second input is multiplied by -1 for antisymmetric coefficients (exact)
+    __m512d sign = _mm512_set1_pd(antisymmetric ? -1.0 : 1.0);
+    int i = 0;
+    for (; i + 32 <= num_outputs; i += 32) {
+        __m512d sum_0 = _mm512_setzero_pd(), sum_1 = _mm512_setzero_pd();
+        __m512d sum_2 = _mm512_setzero_pd(), sum_3 = _mm512_setzero_pd();
+        const double * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m512d coefficient = _mm512_set1_pd(c[j]);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m512d folded_0 = _mm512_fmadd_pd(sign, _mm512_loadu_pd(window + last - j), _mm512_loadu_pd(window + j));
+            __m512d folded_1 = _mm512_fmadd_pd(
+                sign, _mm512_loadu_pd(window + last - j + 8), _mm512_loadu_pd(window + j + 8)
+            );
+            __m512d folded_2 = _mm512_fmadd_pd(
+                sign, _mm512_loadu_pd(window + last - j + 16), _mm512_loadu_pd(window + j + 16)
+            );
+            __m512d folded_3 = _mm512_fmadd_pd(
+                sign, _mm512_loadu_pd(window + last - j + 24), _mm512_loadu_pd(window + j + 24)
+            );
+            sum_0 = _mm512_fmadd_pd(coefficient, folded_0, sum_0);
+            sum_1 = _mm512_fmadd_pd(coefficient, folded_1, sum_1);
+            sum_2 = _mm512_fmadd_pd(coefficient, folded_2, sum_2);
+            sum_3 = _mm512_fmadd_pd(coefficient, folded_3, sum_3);
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m512d coefficient = _mm512_set1_pd(c[half_length]);
+            sum_0 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + half_length), sum_0);
+            sum_1 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + half_length + 8), sum_1);
+            sum_2 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + half_length + 16), sum_2);
+            sum_3 = _mm512_fmadd_pd(coefficient, _mm512_loadu_pd(window + half_length + 24), sum_3);
+        }
+        _mm512_storeu_pd(y + i, sum_0);
+        _mm512_storeu_pd(y + i + 8, sum_1);
+        _mm512_storeu_pd(y + i + 16, sum_2);
+        _mm512_storeu_pd(y + i + 24, sum_3);
+    }
+    for (; i < num_outputs; ++i) {
+        y[i] = folded_output(c, num_coefficients, antisymmetric, x + i);
+    }
+}
+
+static void fir_block_float_sse(const float * c, int num_coefficients, const float * x, float * y, int num_outputs) {
+    /* SSE single precision block kernel (16 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 16 <= num_outputs; i += 16) {
+        __m128 sum_0 = _mm_setzero_ps(), sum_1 = _mm_setzero_ps();
+        __m128 sum_2 = _mm_setzero_ps(), sum_3 = _mm_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m128 coefficient = _mm_set1_ps(c[j]);
+            sum_0 = _mm_add_ps(sum_0, _mm_mul_ps(coefficient, _mm_loadu_ps(window + j)));
+            sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(coefficient, _mm_loadu_ps(window + j + 4)));
+            sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(coefficient, _mm_loadu_ps(window + j + 8)));
+            sum_3 = _mm_add_ps(sum_3, _mm_mul_ps(coefficient, _mm_loadu_ps(window + j + 12)));
+        }
+        _mm_storeu_ps(y + i, sum_0);
+        _mm_storeu_ps(y + i + 4, sum_1);
+        _mm_storeu_ps(y + i + 8, sum_2);
+        _mm_storeu_ps(y + i + 12, sum_3);
+    }
+    fir_block_scalar(c, num_coefficients, x + i, y + i, num_outputs - i);
+}
+
+TARGET_AVX2 static void fir_block_float_avx2(
+    const float * c, int num_coefficients, const float * x, float * y, int num_outputs
+) {
+    /* AVX2 + FMA single precision block kernel (32 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 32 <= num_outputs; i += 32) {
+        __m256 sum_0 = _mm256_setzero_ps(), sum_1 = _mm256_setzero_ps();
+        __m256 sum_2 = _mm256_setzero_ps(), sum_3 = _mm256_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m256 coefficient = _mm256_broadcast_ss(c + j);
+            sum_0 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + j), sum_0);
+            sum_1 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + j + 8), sum_1);
+            sum_2 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + j + 16), sum_2);
+            sum_3 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + j + 24), sum_3);
+        }
+        _mm256_storeu_ps(y + i, sum_0);
+        _mm256_storeu_ps(y + i + 8, sum_1);
+        _mm256_storeu_ps(y + i + 16, sum_2);
+        _mm256_storeu_ps(y + i + 24, sum_3);
+    }
+    // fewer than 32 outputs are left, so 8 at a time is still worthwhile
+    for (; i + 8 <= num_outputs; i += 8) {
+        __m256 sum = _mm256_setzero_ps();
+        for (int j = 0; j < num_coefficients; ++j) {
+            sum = _mm256_fmadd_ps(_mm256_broadcast_ss(c + j), _mm256_loadu_ps(x + i + j), sum);
+        }
+        _mm256_storeu_ps(y + i, sum);
+    }
+    fir_block_scalar(c, num_coefficients, x + i, y + i, num_outputs - i);
+}
+
+TARGET_AVX512 static void fir_block_float_avx512(
+    const float * c, int num_coefficients, const float * x, float * y, int num_outputs
+) {
+    /* AVX-512 single precision block kernel (64 neighbouring outputs share each coefficient, 4 accumulators) */
+
+    int i = 0;
+    for (; i + 64 <= num_outputs; i += 64) {
+        __m512 sum_0 = _mm512_setzero_ps(), sum_1 = _mm512_setzero_ps();
+        __m512 sum_2 = _mm512_setzero_ps(), sum_3 = _mm512_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < num_coefficients; ++j) {
+            __m512 coefficient = _mm512_set1_ps(c[j]);
+            sum_0 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + j), sum_0);
+            sum_1 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + j + 16), sum_1);
+            sum_2 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + j + 32), sum_2);
+            sum_3 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + j + 48), sum_3);
+        }
+        _mm512_storeu_ps(y + i, sum_0);
+        _mm512_storeu_ps(y + i + 16, sum_1);
+        _mm512_storeu_ps(y + i + 32, sum_2);
+        _mm512_storeu_ps(y + i + 48, sum_3);
+    }
+    // the remaining outputs are calculated 16 at a time (masked for the last few)
+    for (; i < num_outputs; i += 16) {
+        auto mask = (__mmask16) ((num_outputs - i >= 16) ? 0xffff : (1u << (num_outputs - i)) - 1u);
+        __m512 sum = _mm512_setzero_ps();
+        for (int j = 0; j < num_coefficients; ++j) {
+            sum = _mm512_fmadd_ps(_mm512_set1_ps(c[j]), _mm512_maskz_loadu_ps(mask, x + i + j), sum);
+        }
+        _mm512_mask_storeu_ps(y + i, mask, sum);
+    }
+}
+
+static void fir_block_folded_float_sse(
+    const float * c, int num_coefficients, bool antisymmetric, const float * x, float * y, int num_outputs
+) {
+    /* SSE single precision folded block kernel (16 neighbouring outputs, 4 accumulators) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    // subtracting is done by flipping the sign bit of the second input
+    __m128 sign = antisymmetric ? _mm_set1_ps(-0.0f) : _mm_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= num_outputs; i += 16) {
+        __m128 sum_0 = _mm_setzero_ps(), sum_1 = _mm_setzero_ps();
+        __m128 sum_2 = _mm_setzero_ps(), sum_3 = _mm_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m128 coefficient = _mm_set1_ps(c[j]);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m128 folded_0 = _mm_add_ps(_mm_loadu_ps(window + j), _mm_xor_ps(_mm_loadu_ps(window + last - j), sign));
+            __m128 folded_1 = _mm_add_ps(
+                _mm_loadu_ps(window + j + 4), _mm_xor_ps(_mm_loadu_ps(window + last - j + 4), sign)
+            );
+            __m128 folded_2 = _mm_add_ps(
+                _mm_loadu_ps(window + j + 8), _mm_xor_ps(_mm_loadu_ps(window + last - j + 8), sign)
+            );
+            __m128 folded_3 = _mm_add_ps(
+                _mm_loadu_ps(window + j + 12), _mm_xor_ps(_mm_loadu_ps(window + last - j + 12), sign)
+            );
+            sum_0 = _mm_add_ps(sum_0, _mm_mul_ps(coefficient, folded_0));
+            sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(coefficient, folded_1));
+            sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(coefficient, folded_2));
+            sum_3 = _mm_add_ps(sum_3, _mm_mul_ps(coefficient, folded_3));
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m128 coefficient = _mm_set1_ps(c[half_length]);
+            sum_0 = _mm_add_ps(sum_0, _mm_mul_ps(coefficient, _mm_loadu_ps(window + half_length)));
+            sum_1 = _mm_add_ps(sum_1, _mm_mul_ps(coefficient, _mm_loadu_ps(window + half_length + 4)));
+            sum_2 = _mm_add_ps(sum_2, _mm_mul_ps(coefficient, _mm_loadu_ps(window + half_length + 8)));
+            sum_3 = _mm_add_ps(sum_3, _mm_mul_ps(coefficient, _mm_loadu_ps(window + half_length + 12)));
+        }
+        _mm_storeu_ps(y + i, sum_0);
+        _mm_storeu_ps(y + i + 4, sum_1);
+        _mm_storeu_ps(y + i + 8, sum_2);
+        _mm_storeu_ps(y + i + 12, sum_3);
+    }
+    fir_block_folded_scalar(c, num_coefficients, antisymmetric, x + i, y + i, num_outputs - i);
+}
+
+TARGET_AVX2 static void fir_block_folded_float_avx2(
+    const float * c, int num_coefficients, bool antisymmetric, const float * x, float * y, int num_outputs
+) {
+    /* AVX2 + FMA single precision folded block kernel (32 neighbouring outputs, 4 accumulators) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    // subtracting is done by flipping the sign bit of the second input
+    __m256 sign = antisymmetric ? _mm256_set1_ps(-0.0f) : _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= num_outputs; i += 32) {
+        __m256 sum_0 = _mm256_setzero_ps(), sum_1 = _mm256_setzero_ps();
+        __m256 sum_2 = _mm256_setzero_ps(), sum_3 = _mm256_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m256 coefficient = _mm256_broadcast_ss(c + j);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m256 folded_0 = _mm256_add_ps(
+                _mm256_loadu_ps(window + j), _mm256_xor_ps(_mm256_loadu_ps(window + last - j), sign)
+            );
+            __m256 folded_1 = _mm256_add_ps(
+                _mm256_loadu_ps(window + j + 8), _mm256_xor_ps(_mm256_loadu_ps(window + last - j + 8), sign)
+            );
+            __m256 folded_2 = _mm256_add_ps(
+                _mm256_loadu_ps(window + j + 16), _mm256_xor_ps(_mm256_loadu_ps(window + last - j + 16), sign)
+            );
+            __m256 folded_3 = _mm256_add_ps(
+                _mm256_loadu_ps(window + j + 24), _mm256_xor_ps(_mm256_loadu_ps(window + last - j + 24), sign)
+            );
+            sum_0 = _mm256_fmadd_ps(coefficient, folded_0, sum_0);
+            sum_1 = _mm256_fmadd_ps(coefficient, folded_1, sum_1);
+            sum_2 = _mm256_fmadd_ps(coefficient, folded_2, sum_2);
+            sum_3 = _mm256_fmadd_ps(coefficient, folded_3, sum_3);
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m256 coefficient = _mm256_broadcast_ss(c + half_length);
+            sum_0 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + half_length), sum_0);
+            sum_1 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + half_length + 8), sum_1);
+            sum_2 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + half_length + 16), sum_2);
+            sum_3 = _mm256_fmadd_ps(coefficient, _mm256_loadu_ps(window + half_length + 24), sum_3);
+        }
+        _mm256_storeu_ps(y + i, sum_0);
+        _mm256_storeu_ps(y + i + 8, sum_1);
+        _mm256_storeu_ps(y + i + 16, sum_2);
+        _mm256_storeu_ps(y + i + 24, sum_3);
+    }
+    fir_block_folded_scalar(c, num_coefficients, antisymmetric, x + i, y + i, num_outputs - i);
+}
+
+TARGET_AVX512 static void fir_block_folded_float_avx512(
+    const float * c, int num_coefficients, bool antisymmetric, const float * x, float * y, int num_outputs
+) {
+    /* AVX-512 single precision folded block kernel (64 neighbouring outputs, 4 accumulators, masked tail) */
+
+    int half_length = num_coefficients / 2;
+    int last = num_coefficients - 1;
+    // the second input is multiplied by -1 for antisymmetric coefficients (exact)
+    __m512 sign = _mm512_set1_ps(antisymmetric ? -1.0f : 1.0f);
+    int i = 0;
+    for (; i + 64 <= num_outputs; i += 64) {
+        __m512 sum_0 = _mm512_setzero_ps(), sum_1 = _mm512_setzero_ps();
+        __m512 sum_2 = _mm512_setzero_ps(), sum_3 = _mm512_setzero_ps();
+        const float * window = x + i;
+        for (int j = 0; j < half_length; ++j) {
+            __m512 coefficient = _mm512_set1_ps(c[j]);
+            // inputs j and N - 1 - j share a coefficient, so they are combined before multiplying
+            __m512 folded_0 = _mm512_fmadd_ps(sign, _mm512_loadu_ps(window + last - j), _mm512_loadu_ps(window + j));
+            __m512 folded_1 = _mm512_fmadd_ps(
+                sign, _mm512_loadu_ps(window + last - j + 16), _mm512_loadu_ps(window + j + 16)
+            );
+            __m512 folded_2 = _mm512_fmadd_ps(
+                sign, _mm512_loadu_ps(window + last - j + 32), _mm512_loadu_ps(window + j + 32)
+            );
+            __m512 folded_3 = _mm512_fmadd_ps(
+                sign, _mm512_loadu_ps(window + last - j + 48), _mm512_loadu_ps(window + j + 48)
+            );
+            sum_0 = _mm512_fmadd_ps(coefficient, folded_0, sum_0);
+            sum_1 = _mm512_fmadd_ps(coefficient, folded_1, sum_1);
+            sum_2 = _mm512_fmadd_ps(coefficient, folded_2, sum_2);
+            sum_3 = _mm512_fmadd_ps(coefficient, folded_3, sum_3);
+        }
+        if (num_coefficients % 2 == 1) {
+            // the middle coefficient has no partner
+            __m512 coefficient = _mm512_set1_ps(c[half_length]);
+            sum_0 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + half_length), sum_0);
+            sum_1 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + half_length + 16), sum_1);
+            sum_2 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + half_length + 32), sum_2);
+            sum_3 = _mm512_fmadd_ps(coefficient, _mm512_loadu_ps(window + half_length + 48), sum_3);
+        }
+        _mm512_storeu_ps(y + i, sum_0);
+        _mm512_storeu_ps(y + i + 16, sum_1);
+        _mm512_storeu_ps(y + i + 32, sum_2);
+        _mm512_storeu_ps(y + i + 48, sum_3);
+    }
+    // the remaining outputs are calculated 16 at a time (masked for the last few)
+    for (; i < num_outputs; i += 16) {
+        auto mask = (__mmask16) ((num_outputs - i >= 16) ? 0xffff : (1u << (num_outputs - i)) - 1u);
+        const float * window = x + i;
+        __m512 sum = _mm512_setzero_ps();
+        for (int j = 0; j < half_length; ++j) {
+            __m512 folded = _mm512_fmadd_ps(
+                sign, _mm512_maskz_loadu_ps(mask, window + last - j), _mm512_maskz_loadu_ps(mask, window + j)
+            );
+            sum = _mm512_fmadd_ps(_mm512_set1_ps(c[j]), folded, sum);
+        }
+        if (num_coefficients % 2 == 1) {
+            sum = _mm512_fmadd_ps(_mm512_set1_ps(c[half_length]), _mm512_maskz_loadu_ps(mask, window + half_length), sum);
+        }
+        _mm512_mask_storeu_ps(y + i, mask, sum);
+    }
+}
+
+static inline void q15_sums_sse2(
+    const int * pairs,
+    int num_coefficients,
+    int first_pair,
+    int end_pair,
+    const signed short * window,
+    __m128i& sum_low,
+    __m128i& sum_high
+) {
+    /* Calculates the 32 bit sums of 8 neighbouring outputs over a group of coefficient pairs
+     *
+     * Inputs x_(i+j) and x_(i+j+1) are interleaved so that each 32 bit element of pmaddwd calculates
+     * c_j * x_(i+j) + c_(j+1) * x_(i+j+1) for one output (2 taps of 4 outputs per instruction).
+     */
+
+    int full_end = std::min(end_pair, num_coefficients / 2);
+    sum_low = _mm_setzero_si128();
+    sum_high = _mm_setzero_si128();
+    for (int p = first_pair; p < full_end; ++p) {
+        __m128i coefficients = _mm_set1_epi32(pairs[p]);
+        __m128i current = _mm_loadu_si128((const __m128i *) (window + 2 * p));
+        __m128i next = _mm_loadu_si128((const __m128i *) (window + 2 * p + 1));
+        sum_low = _mm_add_epi32(sum_low, _mm_madd_epi16(_mm_unpacklo_epi16(current, next), coefficients));
+        sum_high = _mm_add_epi32(sum_high, _mm_madd_epi16(_mm_unpackhi_epi16(current, next), coefficients));
+    }
+    if (full_end < end_pair) {
+        // the last coefficient has no partner, so it is paired with 0 (nothing past the window is read)
+        __m128i coefficients = _mm_set1_epi32(pairs[full_end]);
+        __m128i current = _mm_loadu_si128((const __m128i *) (window + 2 * full_end));
+        __m128i zero = _mm_setzero_si128();
+        sum_low = _mm_add_epi32(sum_low, _mm_madd_epi16(_mm_unpacklo_epi16(current, zero), coefficients));
+        sum_high = _mm_add_epi32(sum_high, _mm_madd_epi16(_mm_unpackhi_epi16(current, zero), coefficients));
+    }
+}
+
+static void fir_block_q15_sse2(
+    const Q15Coefficients& coefficients, const signed short * x, signed short * y, int num_outputs
+) {
+    /* SSE2 fixed point block kernel (8 outputs at a time) */
+
+    auto num_coefficients = (int) coefficients.reversed_coefficients.size();
+    int shift = coefficients.shift;
+    const std::vector<int>& pairs = coefficients.pairs;
+    const std::vector<int>& group_ends = coefficients.group_ends;
+    const __m128i rounding = _mm_set1_epi32(shift > 0 ? 1 << (shift - 1) : 0);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    int num_pairs = (int) pairs.size();
+    int i = 0;
+    if (group_ends.size() == 1) {
+        for (; i + 8 <= num_outputs; i += 8) {
+            __m128i sum_low, sum_high;
+            q15_sums_sse2(pairs.data(), num_coefficients, 0, num_pairs, x + i, sum_low, sum_high);
+            sum_low = _mm_sra_epi32(_mm_add_epi32(sum_low, rounding), shift_count);
+            sum_high = _mm_sra_epi32(_mm_add_epi32(sum_high, rounding), shift_count);
+            // packing saturates to the int16 range
+            _mm_storeu_si128((__m128i *) (y + i), _mm_packs_epi32(sum_low, sum_high));
+        }
+    }
+    else {
+        // SSE2 has no 64 bit comparisons or sign extension, so the group sums are added outside the registers
+        for (; i + 8 <= num_outputs; i += 8) {
+            long long sums[8] = {};
+            int first_pair = 0;
+            for (int end_pair : group_ends) {
+                __m128i sum_low, sum_high;
+                q15_sums_sse2(pairs.data(), num_coefficients, first_pair, end_pair, x + i, sum_low, sum_high);
+                alignas(16) int group_sums[8];
+                _mm_store_si128((__m128i *) group_sums, sum_low);
+                _mm_store_si128((__m128i *) (group_sums + 4), sum_high);
+                for (int k = 0; k < 8; ++k) sums[k] += group_sums[k];
+                first_pair = end_pair;
+            }
+            for (int k = 0; k < 8; ++k) y[i + k] = round_q15_output(sums[k], shift);
+        }
+    }
+    fir_block_q15_scalar(coefficients, x + i, y + i, num_outputs - i);
+}
+
+TARGET_AVX2 static inline void q15_sums_avx2(
+    const int * pairs,
+    int num_coefficients,
+    int first_pair,
+    int end_pair,
+    const signed short * window,
+    __m256i& sum_low,
+    __m256i& sum_high
+) {
+    /* Calculates the 32 bit sums of 16 neighbouring outputs over a group of coefficient pairs with vpmaddwd
+     *
+     * Unpacking works within each 128 bit lane, so the low sums hold outputs 0-3 and 8-11 and the high sums
+     * hold outputs 4-7 and 12-15.
+     */
+
+    int full_end = std::min(end_pair, num_coefficients / 2);
+    sum_low = _mm256_setzero_si256();
+    sum_high = _mm256_setzero_si256();
+    for (int p = first_pair; p < full_end; ++p) {
+        __m256i coefficients = _mm256_set1_epi32(pairs[p]);
+        __m256i current = _mm256_loadu_si256((const __m256i *) (window + 2 * p));
+        __m256i next = _mm256_loadu_si256((const __m256i *) (window + 2 * p + 1));
+        sum_low = _mm256_add_epi32(sum_low, _mm256_madd_epi16(_mm256_unpacklo_epi16(current, next), coefficients));
+        sum_high = _mm256_add_epi32(sum_high, _mm256_madd_epi16(_mm256_unpackhi_epi16(current, next), coefficients));
+    }
+    if (full_end < end_pair) {
+        // the last coefficient has no partner, so it is paired with 0 (nothing past the window is read)
+        __m256i coefficients = _mm256_set1_epi32(pairs[full_end]);
+        __m256i current = _mm256_loadu_si256((const __m256i *) (window + 2 * full_end));
+        __m256i zero = _mm256_setzero_si256();
+        sum_low = _mm256_add_epi32(sum_low, _mm256_madd_epi16(_mm256_unpacklo_epi16(current, zero), coefficients));
+        sum_high = _mm256_add_epi32(sum_high, _mm256_madd_epi16(_mm256_unpackhi_epi16(current, zero), coefficients));
+    }
+}
+
+TARGET_AVX2 static inline __m128i narrow_q15_sums_avx2(__m256i sums) {
+    /* Clamps 4 64 bit sums to +-2^30 and packs them into 32 bits
+     *
+     * Any sum outside +-2^30 is saturated after shifting by up to 15 bits anyway, and rounding can't overflow.
+     */
+
+    const __m256i largest = _mm256_set1_epi64x(1LL << 30);
+    const __m256i smallest = _mm256_set1_epi64x(-(1LL << 30));
+    sums = _mm256_blendv_epi8(sums, largest, _mm256_cmpgt_epi64(sums, largest));
+    sums = _mm256_blendv_epi8(sums, smallest, _mm256_cmpgt_epi64(smallest, sums));
+    // the low halves of the 64 bit elements are moved to the bottom 128 bits
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(sums, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+}
+
+TARGET_AVX2 static void fir_block_q15_avx2(
+    const Q15Coefficients& coefficients, const signed short * x, signed short * y, int num_outputs
+) {
+    /* AVX2 fixed point block kernel (16 outputs at a time, packing within lanes puts them back in order)
+     *
+     * If the taps are split into groups, the group sums are sign extended and added in 64 bit registers.
+     */
+
+    auto num_coefficients = (int) coefficients.reversed_coefficients.size();
+    int shift = coefficients.shift;
+    const std::vector<int>& pairs = coefficients.pairs;
+    const std::vector<int>& group_ends = coefficients.group_ends;
+    const __m256i rounding = _mm256_set1_epi32(shift > 0 ? 1 << (shift - 1) : 0);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    int num_pairs = (int) pairs.size();
+    int i = 0;
+    for (; i + 16 <= num_outputs; i += 16) {
+        __m256i sum_low, sum_high;
+        if (group_ends.size() == 1) {
+            q15_sums_avx2(pairs.data(), num_coefficients, 0, num_pairs, x + i, sum_low, sum_high);
+        }
+        else {
+            // 64 bit sums of outputs 0-3, 8-11, 4-7 and 12-15
+            __m256i sums_0 = _mm256_setzero_si256(), sums_1 = _mm256_setzero_si256();
+            __m256i sums_2 = _mm256_setzero_si256(), sums_3 = _mm256_setzero_si256();
+            int first_pair = 0;
+            for (int end_pair : group_ends) {
+                q15_sums_avx2(pairs.data(), num_coefficients, first_pair, end_pair, x + i, sum_low, sum_high);
+                sums_0 = _mm256_add_epi64(sums_0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(sum_low)));
+                sums_1 = _mm256_add_epi64(sums_1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sum_low, 1)));
+                sums_2 = _mm256_add_epi64(sums_2, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(sum_high)));
+                sums_3 = _mm256_add_epi64(sums_3, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sum_high, 1)));
+                first_pair = end_pair;
+            }
+            sum_low = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(narrow_q15_sums_avx2(sums_0)), narrow_q15_sums_avx2(sums_1), 1
+            );
+            sum_high = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(narrow_q15_sums_avx2(sums_2)), narrow_q15_sums_avx2(sums_3), 1
+            );
+        }
+        sum_low = _mm256_sra_epi32(_mm256_add_epi32(sum_low, rounding), shift_count);
+        sum_high = _mm256_sra_epi32(_mm256_add_epi32(sum_high, rounding), shift_count);
+        // packing saturates to the int16 range
+        _mm256_storeu_si256((__m256i *) (y + i), _mm256_packs_epi32(sum_low, sum_high));
+    }
+    fir_block_q15_sse2(coefficients, x + i, y + i, num_outputs - i);
+}
+
+#endif
+
+CoefficientSymmetry detect_symmetry(const double * coefficients, int num_coefficients) {
+    /* Checks if the coefficients are symmetric (b_k = b_(N-1-k)) or antisymmetric (b_k = -b_(N-1-k))
+     *
+     * param coefficients: Pointer to the filter coefficients
+     * param num_coefficients: Number of filter coefficients
+     * return: symmetric, antisymmetric or no_symmetry
+     */
+
+    if (num_coefficients < 2) return no_symmetry;
+
+    double largest = 0.0;
+    for (int i = 0; i < num_coefficients; ++i) {
+        largest = std::max(largest, fabs(coefficients[i]));
+    }
+    // allows for rounding errors (e.g. from window functions)
+    double tolerance = 1e-12 * largest;
+
+    bool is_symmetric = true, is_antisymmetric = true;
+    for (int i = 0; i <= num_coefficients / 2; ++i) {
+        double first = coefficients[i];
+        double second = coefficients[num_coefficients - 1 - i];
+        if (fabs(first - second) > tolerance) is_symmetric = false;
+        if (fabs(first + second) > tolerance) is_antisymmetric = false;
+    }
+    if (is_symmetric) return symmetric;
+    if (is_antisymmetric && largest > 0.0) return antisymmetric;
+    return no_symmetry;
+}
+
+SimdLevel detect_simd_level() {
+    /* Finds the newest instruction set supported by both the CPU and the operating system
+     *
+     * return: simd level used by the dot product kernels
+     */
+
+#ifdef FIR_KERNELS_X86_64
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    bool has_fma = (info[2] & (1 << 12)) != 0;
+    bool has_os_xsave = (info[2] & (1 << 27)) != 0;
+    bool has_avx = (info[2] & (1 << 28)) != 0;
+    unsigned long long xcr_0 = has_os_xsave ? _xgetbv(0) : 0;
+    // the OS must save the YMM (and ZMM) registers on context switches
+    bool os_saves_ymm = (xcr_0 & 0x6) == 0x6;
+    bool os_saves_zmm = (xcr_0 & 0xe6) == 0xe6;
+    bool has_avx2 = false, has_avx512 = false;
+    if (max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        has_avx2 = (info[1] & (1 << 5)) != 0;
+        has_avx512 = (info[1] & (1 << 16)) != 0;
+    }
+    if (has_avx512 && os_saves_zmm) return avx512_simd;
+    if (has_avx && has_avx2 && has_fma && os_saves_ymm) return avx2_simd;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return avx512_simd;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return avx2_simd;
+#endif
+    // SSE2 is part of the x86-64 baseline
+    return sse2_simd;
+#else
+    return scalar_simd;
+#endif
+}
+
+std::string get_simd_level_name(SimdLevel simd_level) {
+    /*
+     * return: Readable name of the instruction set
+     */
+
+    if (simd_level == avx512_simd) return "AVX-512";
+    if (simd_level == avx2_simd) return "AVX2 + FMA";
+    if (simd_level == sse2_simd) return "SSE2";
+    return "Scalar";
+}
+
+static SimdLevel get_supported_level(SimdLevel simd_level) {
+    /* Caps an instruction set at the newest one supported by the CPU */
+
+    // the CPU is only checked once
+    static const SimdLevel supported_level = detect_simd_level();
+    return (simd_level > supported_level) ? supported_level : simd_level;
+}
+
+static DotProductKernel get_dot_product_kernel(SimdLevel simd_level) {
+    /* Gets the dot product kernel for an instruction set (falls back to an older set if unsupported) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level == avx512_simd) return dot_product_avx512;
+    if (simd_level == avx2_simd) return dot_product_avx2;
+    if (simd_level == sse2_simd) return dot_product_sse2;
+#endif
+    return dot_product_scalar<double>;
+}
+
+static FirBlockKernel get_fir_block_kernel(SimdLevel simd_level) {
+    /* Gets the block FIR kernel for an instruction set (falls back to an older set if unsupported) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level == avx512_simd) return fir_block_avx512;
+    if (simd_level == avx2_simd) return fir_block_avx2;
+    if (simd_level == sse2_simd) return fir_block_sse2;
+#endif
+    return fir_block_scalar<double>;
+}
+
+static FoldedFirBlockKernel get_folded_fir_block_kernel(SimdLevel simd_level) {
+    /* Gets the folded block FIR kernel for an instruction set (falls back to an older set if unsupported) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level == avx512_simd) return fir_block_folded_avx512;
+    if (simd_level == avx2_simd) return fir_block_folded_avx2;
+    if (simd_level == sse2_simd) return fir_block_folded_sse2;
+#endif
+    return fir_block_folded_scalar<double>;
+}
+
+static FloatFirBlockKernel get_float_fir_block_kernel(SimdLevel simd_level) {
+    /* Gets the single precision block FIR kernel for an instruction set (falls back to an older set if unsupported) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level == avx512_simd) return fir_block_float_avx512;
+    if (simd_level == avx2_simd) return fir_block_float_avx2;
+    if (simd_level == sse2_simd) return fir_block_float_sse;
+#endif
+    return fir_block_scalar<float>;
+}
+
+static FloatFoldedFirBlockKernel get_float_folded_fir_block_kernel(SimdLevel simd_level) {
+    /* Gets the single precision folded block FIR kernel (falls back to an older set if unsupported) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level == avx512_simd) return fir_block_folded_float_avx512;
+    if (simd_level == avx2_simd) return fir_block_folded_float_avx2;
+    if (simd_level == sse2_simd) return fir_block_folded_float_sse;
+#endif
+    return fir_block_folded_scalar<float>;
+}
+
+static Q15FirBlockKernel get_q15_fir_block_kernel(SimdLevel simd_level) {
+    /* Gets the fixed point block FIR kernel (AVX-512 uses the AVX2 kernel, as vpmaddwd needs AVX-512BW) */
+
+    simd_level = get_supported_level(simd_level);
+#ifdef FIR_KERNELS_X86_64
+    if (simd_level >= avx2_simd) return fir_block_q15_avx2;
+    if (simd_level == sse2_simd) return fir_block_q15_sse2;
+#endif
+    return fir_block_q15_scalar;
+}
+
+double dot_product(const double * a, const double * b, int length) {
+    /* Multiplies and accumulates two arrays using the best kernel for this CPU
+     *
+     * param a: Pointer to the first array (e.g. filter coefficients)
+     * param b: Pointer to the second array (e.g. input history)
+     * param length: Number of elements in each array
+     * return: sum{i=0->N-1}(a_i * b_i)
+     */
+
+    // the kernel is only selected on the first call
+    static const DotProductKernel kernel = get_dot_product_kernel(avx512_simd);
+    return kernel(a, b, length);
+}
+
+double dot_product(const double * a, const double * b, int length, SimdLevel simd_level) {
+    /* Multiplies and accumulates two arrays using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    return get_dot_product_kernel(simd_level)(a, b, length);
+}
+
+void fir_block(
+    const double * reversed_coefficients, int num_coefficients, const double * input, double * output, int num_outputs
+) {
+    /* Filters a block using the best kernel for this CPU (neighbouring outputs are calculated together)
+     *
+     * param reversed_coefficients: Pointer to the filter coefficients in reverse order (b_(N-1) ... b_0)
+     * param num_coefficients: Number of filter coefficients (N)
+     * param input: Pointer to num_outputs + N - 1 inputs in time order (the N - 1 previous inputs come first)
+     * param output: Pointer to a buffer that receives num_outputs filtered samples
+     * param num_outputs: Number of outputs to calculate
+     */
+
+    // the kernel is only selected on the first call
+    static const FirBlockKernel kernel = get_fir_block_kernel(avx512_simd);
+    kernel(reversed_coefficients, num_coefficients, input, output, num_outputs);
+}
+
+void fir_block(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    const double * input,
+    double * output,
+    int num_outputs,
+    SimdLevel simd_level
+) {
+    /* Filters a block using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    get_fir_block_kernel(simd_level)(reversed_coefficients, num_coefficients, input, output, num_outputs);
+}
+
+void fir_block_folded(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const double * input,
+    double * output,
+    int num_outputs
+) {
+    /* Filters a block of a linear phase FIR (half the multiplies of fir_block)
+     *
+     * param reversed_coefficients: Pointer to the filter coefficients in reverse order (b_(N-1) ... b_0)
+     * param num_coefficients: Number of filter coefficients (N)
+     * param symmetry: symmetric or antisymmetric (from detect_symmetry)
+     * param input: Pointer to num_outputs + N - 1 inputs in time order (the N - 1 previous inputs come first)
+     * param output: Pointer to a buffer that receives num_outputs filtered samples
+     * param num_outputs: Number of outputs to calculate
+     */
+
+    if (symmetry == no_symmetry) {
+        fir_block(reversed_coefficients, num_coefficients, input, output, num_outputs);
+        return;
+    }
+    // the kernel is only selected on the first call
+    static const FoldedFirBlockKernel kernel = get_folded_fir_block_kernel(avx512_simd);
+    kernel(reversed_coefficients, num_coefficients, symmetry == antisymmetric, input, output, num_outputs);
+}
+
+void fir_block_folded(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const double * input,
+    double * output,
+    int num_outputs,
+    SimdLevel simd_level
+) {
+    /* Filters a block of a linear phase FIR using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    if (symmetry == no_symmetry) {
+        fir_block(reversed_coefficients, num_coefficients, input, output, num_outputs, simd_level);
+        return;
+    }
+    get_folded_fir_block_kernel(simd_level)(
+        reversed_coefficients, num_coefficients, symmetry == antisymmetric, input, output, num_outputs
+    );
+}
+
+void fir_block(
+    const float * reversed_coefficients, int num_coefficients, const float * input, float * output, int num_outputs
+) {
+    /* Filters a single precision block using the best kernel for this CPU (twice as many outputs per register)
+     *
+     * param reversed_coefficients: Pointer to the filter coefficients in reverse order (b_(N-1) ... b_0)
+     * param num_coefficients: Number of filter coefficients (N)
+     * param input: Pointer to num_outputs + N - 1 inputs in time order (the N - 1 previous inputs come first)
+     * param output: Pointer to a buffer that receives num_outputs filtered samples
+     * param num_outputs: Number of outputs to calculate
+     */
+
+    // the kernel is only selected on the first call
+    static const FloatFirBlockKernel kernel = get_float_fir_block_kernel(avx512_simd);
+    kernel(reversed_coefficients, num_coefficients, input, output, num_outputs);
+}
+
+void fir_block(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    const float * input,
+    float * output,
+    int num_outputs,
+    SimdLevel simd_level
+) {
+    /* Filters a single precision block using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    get_float_fir_block_kernel(simd_level)(reversed_coefficients, num_coefficients, input, output, num_outputs);
+}
+
+void fir_block_folded(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const float * input,
+    float * output,
+    int num_outputs
+) {
+    /* Filters a single precision block of a linear phase FIR (half the multiplies of fir_block)
+     *
+     * param reversed_coefficients: Pointer to the filter coefficients in reverse order (b_(N-1) ... b_0)
+     * param num_coefficients: Number of filter coefficients (N)
+     * param symmetry: symmetric or antisymmetric (from detect_symmetry)
+     * param input: Pointer to num_outputs + N - 1 inputs in time order (the N - 1 previous inputs come first)
+     * param output: Pointer to a buffer that receives num_outputs filtered samples
+     * param num_outputs: Number of outputs to calculate
+     */
+
+    if (symmetry == no_symmetry) {
+        fir_block(reversed_coefficients, num_coefficients, input, output, num_outputs);
+        return;
+    }
+    // the kernel is only selected on the first call
+    static const FloatFoldedFirBlockKernel kernel = get_float_folded_fir_block_kernel(avx512_simd);
+    kernel(reversed_coefficients, num_coefficients, symmetry == antisymmetric, input, output, num_outputs);
+}
+
+void fir_block_folded(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const float * input,
+    float * output,
+    int num_outputs,
+    SimdLevel simd_level
+) {
+    /* Filters a single precision block of a linear phase FIR using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    if (symmetry == no_symmetry) {
+        fir_block(reversed_coefficients, num_coefficients, input, output, num_outputs, simd_level);
+        return;
+    }
+    get_float_folded_fir_block_kernel(simd_level)(
+        reversed_coefficients, num_coefficients, symmetry == antisymmetric, input, output, num_outputs
+    );
+}
+
+Q15Coefficients prepare_q15_coefficients(const std::vector<signed short>& reversed_coefficients, int shift) {
+    /* Prepares fixed point coefficients for fir_block_q15 (done once per filter, not once per block)
+     *
+     * param reversed_coefficients: Fixed point coefficients (within +-32767) in reverse order
+     * param shift: Number of fraction bits of the coefficients (0 to 15, 15 for Q15)
+     * return: The coefficients with their pmaddwd pairs and overflow groups
+     */
+
+    Q15Coefficients coefficients;
+    coefficients.reversed_coefficients = reversed_coefficients;
+    coefficients.shift = shift;
+    auto num_coefficients = (int) reversed_coefficients.size();
+    coefficients.pairs = make_q15_coefficient_pairs(reversed_coefficients.data(), num_coefficients);
+    coefficients.group_ends = make_q15_pair_groups(reversed_coefficients.data(), num_coefficients, shift);
+    return coefficients;
+}
+
+void fir_block_q15(
+    const Q15Coefficients& coefficients, const signed short * input, signed short * output, int num_outputs
+) {
+    /* Filters a block of 16 bit samples with fixed point coefficients using the best kernel for this CPU
+     *
+     * Products are summed in 32 bits when sum{j}(|b_j|) * 32768 + 2^(shift - 1) fits in an int. Otherwise the taps
+     * are summed in groups that fit, and the group sums are added in 64 bits.
+     *
+     * param coefficients: Coefficients prepared by prepare_q15_coefficients
+     * param input: Pointer to num_outputs + N - 1 inputs in time order (the N - 1 previous inputs come first)
+     * param output: Pointer to a buffer that receives num_outputs filtered samples (rounded and saturated)
+     * param num_outputs: Number of outputs to calculate
+     */
+
+    // the kernel is only selected on the first call
+    static const Q15FirBlockKernel kernel = get_q15_fir_block_kernel(avx512_simd);
+    kernel(coefficients, input, output, num_outputs);
+}
+
+void fir_block_q15(
+    const Q15Coefficients& coefficients,
+    const signed short * input,
+    signed short * output,
+    int num_outputs,
+    SimdLevel simd_level
+) {
+    /* Filters a block of 16 bit samples using a specific instruction set (used for benchmarking)
+     *
+     * param simd_level: Instruction set to use (capped at the level supported by the CPU)
+     */
+
+    get_q15_fir_block_kernel(simd_level)(coefficients, input, output, num_outputs);
+}
+
+#endif
@@ -0,0 +1,111 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef FIR_KERNELS_HPP
+#define FIR_KERNELS_HPP
+
+#include <string>
+#include <vector>
+
+/* Instruction sets that the FIR kernels can use (x86-64 only, other CPUs use the scalar kernel) */
+enum SimdLevel { scalar_simd, sse2_simd, avx2_simd, avx512_simd };
+
+/* Symmetry of FIR coefficients (linear phase filters are symmetric or antisymmetric) */
+enum CoefficientSymmetry { no_symmetry, symmetric, antisymmetric };
+
+CoefficientSymmetry detect_symmetry(const double * coefficients, int num_coefficients);
+
+SimdLevel detect_simd_level();
+std::string get_simd_level_name(SimdLevel simd_level);
+
+// sum{i=0->N-1}(a_i * b_i) using the best kernel supported by the CPU
+double dot_product(const double * a, const double * b, int length);
+double dot_product(const double * a, const double * b, int length, SimdLevel simd_level);
+
+// output_i = sum{j=0->N-1}(reversed_coefficients_j * input_(i + j)) for a block of outputs
+void fir_block(
+    const double * reversed_coefficients, int num_coefficients, const double * input, double * output, int num_outputs
+);
+void fir_block(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    const double * input,
+    double * output,
+    int num_outputs,
+    SimdLevel simd_level
+);
+
+// same as fir_block, but pre-adds (or subtracts) the inputs that share a coefficient
+void fir_block_folded(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const double * input,
+    double * output,
+    int num_outputs
+);
+void fir_block_folded(
+    const double * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const double * input,
+    double * output,
+    int num_outputs,
+    SimdLevel simd_level
+);
+
+// single precision versions (twice as many samples per register, coefficients are rounded to float)
+void fir_block(
+    const float * reversed_coefficients, int num_coefficients, const float * input, float * output, int num_outputs
+);
+void fir_block(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    const float * input,
+    float * output,
+    int num_outputs,
+    SimdLevel simd_level
+);
+void fir_block_folded(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const float * input,
+    float * output,
+    int num_outputs
+);
+void fir_block_folded(
+    const float * reversed_coefficients,
+    int num_coefficients,
+    CoefficientSymmetry symmetry,
+    const float * input,
+    float * output,
+    int num_outputs,
+    SimdLevel simd_level
+);
+
+typedef struct q15_coefficients {
+    /* Fixed point FIR coefficients with the layout the Q15 kernels use (prepared once per filter) */
+
+    std::vector<signed short> reversed_coefficients;  // within +-32767, in reverse order
+    std::vector<int> pairs;  // neighbouring coefficients packed into 32 bits for pmaddwd (an odd last one with 0)
+    std::vector<int> group_ends;  // pair after the end of each group whose 32 bit sum can't overflow
+    int shift;  // number of fraction bits (0 to 15, 15 for Q15)
+} Q15Coefficients;
+
+Q15Coefficients prepare_q15_coefficients(const std::vector<signed short>& reversed_coefficients, int shift);
+
+// fixed point versions for 16 bit samples (outputs are rounded, shifted right by shift bits and saturated)
+void fir_block_q15(
+    const Q15Coefficients& coefficients, const signed short * input, signed short * output, int num_outputs
+);
+void fir_block_q15(
+    const Q15Coefficients& coefficients,
+    const signed short * input,
+    signed short * output,
+    int num_outputs,
+    SimdLevel simd_level
+);
+
+#endif //FIR_KERNELS_HPP
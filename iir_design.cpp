@@ -0,0 +1,564 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef IIR_DESIGN_HPP
+
+#include "iir_design.hpp"
+
+typedef std::complex<double> complex_double;
+
+static const double machine_epsilon = std::numeric_limits<double>::epsilon();
+
+static double complete_elliptic_integral(double m) {
+    /* Complete elliptic integral of the first kind K(m), using the arithmetic-geometric mean */
+
+    double a = 1.0;
+    double b = sqrt(1.0 - m);
+    while (fabs(a - b) > machine_epsilon * a) {
+        double next_a = 0.5 * (a + b);
+        b = sqrt(a * b);
+        a = next_a;
+    }
+    return M_PI / (2.0 * a);
+}
+
+static double complementary_elliptic_integral(double m) {
+    /* Complete elliptic integral K(1 - m) (accurate when m is very small) */
+
+    double a = 1.0;
+    double b = sqrt(m);
+    while (fabs(a - b) > machine_epsilon * a) {
+        double next_a = 0.5 * (a + b);
+        b = sqrt(a * b);
+        a = next_a;
+    }
+    return M_PI / (2.0 * a);
+}
+
+static void jacobi_elliptic_functions(double u, double m, double & sn, double & cn, double & dn) {
+    /* Jacobi elliptic functions sn, cn and dn of u with parameter m (descending Landen transformation) */
+
+    if (m < 1e-9) {
+        // close to the circular functions
+        double t = sin(u);
+        double b = cos(u);
+        double ai = 0.25 * m * (u - t * b);
+        sn = t - ai * b;
+        cn = b + ai * t;
+        dn = 1.0 - 0.5 * m * t * t;
+        return;
+    }
+    if (m >= 0.9999999999) {
+        // close to the hyperbolic functions
+        double ai = 0.25 * (1.0 - m);
+        double b = cosh(u);
+        double t = tanh(u);
+        double phi = 1.0 / b;
+        double twon = b * sinh(u);
+        sn = t + ai * (twon - u) / (b * b);
+        ai *= t * phi;
+        cn = phi - ai * (twon - u);
+        dn = phi + ai * (twon + u);
+        return;
+    }
+
+    double a[9], c[9];
+    a[0] = 1.0;
+    c[0] = sqrt(m);
+    double b = sqrt(1.0 - m);
+    double twon = 1.0;
+    int i = 0;
+    while (fabs(c[i] / a[i]) > machine_epsilon && i < 8) {
+        double ai = a[i];
+        ++i;
+        c[i] = 0.5 * (ai - b);
+        double t = sqrt(ai * b);
+        a[i] = 0.5 * (ai + b);
+        b = t;
+        twon *= 2.0;
+    }
+
+    double phi = twon * a[i] * u;
+    double previous_phi = phi;
+    do {
+        double t = c[i] * sin(phi) / a[i];
+        previous_phi = phi;
+        phi = 0.5 * (asin(t) + phi);
+    } while (--i);
+
+    sn = sin(phi);
+    cn = cos(phi);
+    dn = cn / cos(phi - previous_phi);
+}
+
+static complex_double inverse_jacobi_sn(complex_double w, double m) {
+    /* Inverse of the Jacobi sn function for a complex argument (using Landen's transformation) */
+
+    double k = sqrt(m);
+    if (k >= 1.0) {
+        return std::atanh(w);
+    }
+
+    // descending sequence of moduli
+    std::vector<double> moduli = {k};
+    while (moduli.back() != 0.0 && moduli.size() < 12) {
+        double k_n = moduli.back();
+        double k_complement = sqrt((1.0 - k_n) * (1.0 + k_n));
+        moduli.push_back((1.0 - k_complement) / (1.0 + k_complement));
+    }
+
+    double capital_k = M_PI / 2.0;
+    for (int i = 1; i < moduli.size(); ++i) {
+        capital_k *= 1.0 + moduli[i];
+    }
+
+    complex_double w_n = w;
+    for (int i = 0; i + 1 < moduli.size(); ++i) {
+        complex_double k_w = moduli[i] * w_n;
+        complex_double complement = std::sqrt((1.0 - k_w) * (1.0 + k_w));
+        w_n = 2.0 * w_n / ((1.0 + moduli[i + 1]) * (1.0 + complement));
+    }
+    return capital_k * (2.0 / M_PI) * std::asin(w_n);
+}
+
+static double elliptic_degree(int order, double m_1) {
+    /* Solves the degree equation for the elliptic filter selectivity parameter m
+     *
+     * param order: Order of the filter
+     * param m_1: Discrimination parameter (eps_p^2 / eps_s^2)
+     */
+
+    double k_1 = complete_elliptic_integral(m_1);
+    double k_1_complement = complementary_elliptic_integral(m_1);
+
+    // uses the nome q (series converges very quickly)
+    double q_1 = exp(-M_PI * k_1_complement / k_1);
+    double q = pow(q_1, 1.0 / order);
+
+    double numerator = 0.0;
+    for (int i = 0; i <= 7; ++i) {
+        numerator += pow(q, i * (i + 1));
+    }
+    double denominator = 1.0;
+    for (int i = 1; i <= 8; ++i) {
+        denominator += 2.0 * pow(q, i * i);
+    }
+    return 16.0 * q * pow(numerator / denominator, 4.0);
+}
+
+static double product_gain(
+    const std::vector<complex_double>& poles, const std::vector<complex_double>& zeros
+) {
+    /* Gain that gives the prototype unity gain at DC: real(prod(-p) / prod(-z)) */
+
+    complex_double result = 1.0;
+    for (const complex_double & pole : poles) {
+        result *= -pole;
+    }
+    for (const complex_double & zero : zeros) {
+        result /= -zero;
+    }
+    return result.real();
+}
+
+ZerosPolesGain design_analog_prototype(
+    IIRDesign design, int order, double passband_ripple, double stopband_attenuation
+) {
+    /* Designs a normalised analog low pass prototype (cut off = 1 rad/s)
+     *
+     * param design: butterworth, chebyshev_1, chebyshev_2 or elliptic
+     * param order: Order of the prototype (number of poles)
+     * param passband_ripple: Maximum ripple in the pass band in dB (chebyshev_1 and elliptic)
+     * param stopband_attenuation: Minimum attenuation in the stop band in dB (chebyshev_2 and elliptic)
+     * return: Zeros, poles and gain of the prototype
+     */
+
+    if (order < 1) {
+        throw std::runtime_error("IIR filter order must be at least 1!");
+    }
+    if ((design == chebyshev_1 || design == elliptic) && passband_ripple <= 0.0) {
+        throw std::runtime_error("Pass band ripple must be greater than 0 dB!");
+    }
+    if ((design == chebyshev_2 || design == elliptic) && stopband_attenuation <= 0.0) {
+        throw std::runtime_error("Stop band attenuation must be greater than 0 dB!");
+    }
+
+    ZerosPolesGain prototype;
+    prototype.gain = 1.0;
+    int N = order;
+
+    if (design == butterworth) {
+        // poles are evenly spaced around the left half of the unit circle
+        for (int m = -N + 1; m < N; m += 2) {
+            prototype.poles.push_back(-std::exp(complex_double(0.0, M_PI * m / (2.0 * N))));
+        }
+    }
+    else if (design == chebyshev_1) {
+        // poles lie on an ellipse, giving equiripple in the pass band
+        double epsilon = sqrt(pow(10.0, 0.1 * passband_ripple) - 1.0);
+        double mu = asinh(1.0 / epsilon) / N;
+        for (int m = -N + 1; m < N; m += 2) {
+            double theta = M_PI * m / (2.0 * N);
+            prototype.poles.push_back(-std::sinh(complex_double(mu, theta)));
+        }
+        prototype.gain = product_gain(prototype.poles, prototype.zeros);
+        if (N % 2 == 0) {
+            prototype.gain /= sqrt(1.0 + epsilon * epsilon);
+        }
+    }
+    else if (design == chebyshev_2) {
+        // inverse chebyshev: zeros on the imaginary axis, equiripple in the stop band (cut off = stop band edge)
+        double delta = 1.0 / sqrt(pow(10.0, 0.1 * stopband_attenuation) - 1.0);
+        double mu = asinh(1.0 / delta) / N;
+        for (int m = -N + 1; m < N; m += 2) {
+            // the zero at infinity is skipped for odd orders
+            if (m == 0) continue;
+            prototype.zeros.push_back(-std::conj(complex_double(0.0, 1.0) / sin(m * M_PI / (2.0 * N))));
+        }
+        for (int m = -N + 1; m < N; m += 2) {
+            complex_double p = -std::exp(complex_double(0.0, M_PI * m / (2.0 * N)));
+            p = complex_double(sinh(mu) * p.real(), cosh(mu) * p.imag());
+            prototype.poles.push_back(1.0 / p);
+        }
+        prototype.gain = product_gain(prototype.poles, prototype.zeros);
+    }
+    else if (design == elliptic) {
+        // equiripple in both the pass band and the stop band (cut off = pass band edge)
+        double epsilon_squared = pow(10.0, 0.1 * passband_ripple) - 1.0;
+        if (N == 1) {
+            double pole = -sqrt(1.0 / epsilon_squared);
+            prototype.poles.push_back(pole);
+            prototype.gain = -pole;
+            return prototype;
+        }
+
+        double epsilon = sqrt(epsilon_squared);
+        double m_1 = epsilon_squared / (pow(10.0, 0.1 * stopband_attenuation) - 1.0);
+        double k_1 = complete_elliptic_integral(m_1);
+        double m = elliptic_degree(N, m_1);
+        double capital_k = complete_elliptic_integral(m);
+
+        std::vector<double> sn_values, cn_values, dn_values;
+        for (int j = 1 - N % 2; j < N; j += 2) {
+            double sn, cn, dn;
+            jacobi_elliptic_functions(j * capital_k / N, m, sn, cn, dn);
+            sn_values.push_back(sn);
+            cn_values.push_back(cn);
+            dn_values.push_back(dn);
+            // zeros are on the imaginary axis (sn = 0 gives a zero at infinity)
+            if (fabs(sn) > machine_epsilon) {
+                complex_double zero = complex_double(0.0, 1.0 / (sqrt(m) * sn));
+                prototype.zeros.push_back(zero);
+                prototype.zeros.push_back(std::conj(zero));
+            }
+        }
+
+        // inverse jacobi sc function of 1 / epsilon
+        double r = inverse_jacobi_sn(complex_double(0.0, 1.0 / epsilon), m_1).imag();
+        double v_0 = capital_k * r / (N * k_1);
+        double sv, cv, dv;
+        jacobi_elliptic_functions(v_0, 1.0 - m, sv, cv, dv);
+
+        std::vector<complex_double> poles;
+        double pole_norm = 0.0;
+        for (int i = 0; i < sn_values.size(); ++i) {
+            double denominator = 1.0 - (dn_values[i] * sv) * (dn_values[i] * sv);
+            complex_double pole = -complex_double(
+                cn_values[i] * dn_values[i] * sv * cv, sn_values[i] * dv
+            ) / denominator;
+            poles.push_back(pole);
+            pole_norm += std::norm(pole);
+        }
+        for (const complex_double & pole : poles) {
+            prototype.poles.push_back(pole);
+        }
+        // the real pole of an odd order filter is not duplicated
+        for (const complex_double & pole : poles) {
+            if (N % 2 == 0 || fabs(pole.imag()) > machine_epsilon * sqrt(pole_norm)) {
+                prototype.poles.push_back(std::conj(pole));
+            }
+        }
+
+        prototype.gain = product_gain(prototype.poles, prototype.zeros);
+        if (N % 2 == 0) {
+            prototype.gain /= sqrt(1.0 + epsilon_squared);
+        }
+    }
+    else {
+        throw std::runtime_error("Invalid IIR design! Valid designs: butterworth, chebyshev_1, chebyshev_2 and elliptic.");
+    }
+    return prototype;
+}
+
+ZerosPolesGain transform_to_low_pass(const ZerosPolesGain& prototype, double cut_off) {
+    /* Moves the cut off of an analog low pass prototype (cut_off in rad/s) */
+
+    ZerosPolesGain analog;
+    for (const complex_double & zero : prototype.zeros) {
+        analog.zeros.push_back(zero * cut_off);
+    }
+    for (const complex_double & pole : prototype.poles) {
+        analog.poles.push_back(pole * cut_off);
+    }
+    int degree = (int) prototype.poles.size() - (int) prototype.zeros.size();
+    analog.gain = prototype.gain * pow(cut_off, degree);
+    return analog;
+}
+
+ZerosPolesGain transform_to_high_pass(const ZerosPolesGain& prototype, double cut_off) {
+    /* Converts an analog low pass prototype into a high pass filter (s -> cut_off / s) */
+
+    ZerosPolesGain analog;
+    for (const complex_double & zero : prototype.zeros) {
+        analog.zeros.push_back(cut_off / zero);
+    }
+    for (const complex_double & pole : prototype.poles) {
+        analog.poles.push_back(cut_off / pole);
+    }
+    // zeros at infinity move to the origin
+    int degree = (int) prototype.poles.size() - (int) prototype.zeros.size();
+    for (int i = 0; i < degree; ++i) {
+        analog.zeros.push_back(0.0);
+    }
+
+    complex_double gain_ratio = 1.0;
+    for (const complex_double & zero : prototype.zeros) {
+        gain_ratio *= -zero;
+    }
+    for (const complex_double & pole : prototype.poles) {
+        gain_ratio /= -pole;
+    }
+    analog.gain = prototype.gain * gain_ratio.real();
+    return analog;
+}
+
+ZerosPolesGain transform_to_band_pass(const ZerosPolesGain& prototype, double centre, double bandwidth) {
+    /* Converts an analog low pass prototype into a band pass filter (s -> (s^2 + centre^2) / (s * bandwidth)) */
+
+    ZerosPolesGain analog;
+    // each root splits into a pair of roots
+    for (const complex_double & zero : prototype.zeros) {
+        complex_double scaled = zero * bandwidth / 2.0;
+        complex_double offset = std::sqrt(scaled * scaled - centre * centre);
+        analog.zeros.push_back(scaled + offset);
+        analog.zeros.push_back(scaled - offset);
+    }
+    for (const complex_double & pole : prototype.poles) {
+        complex_double scaled = pole * bandwidth / 2.0;
+        complex_double offset = std::sqrt(scaled * scaled - centre * centre);
+        analog.poles.push_back(scaled + offset);
+        analog.poles.push_back(scaled - offset);
+    }
+    // half of the zeros at infinity move to the origin
+    int degree = (int) prototype.poles.size() - (int) prototype.zeros.size();
+    for (int i = 0; i < degree; ++i) {
+        analog.zeros.push_back(0.0);
+    }
+    analog.gain = prototype.gain * pow(bandwidth, degree);
+    return analog;
+}
+
+ZerosPolesGain transform_to_band_stop(const ZerosPolesGain& prototype, double centre, double bandwidth) {
+    /* Converts an analog low pass prototype into a band stop filter (s -> (s * bandwidth) / (s^2 + centre^2)) */
+
+    ZerosPolesGain analog;
+    for (const complex_double & zero : prototype.zeros) {
+        complex_double inverted = (bandwidth / 2.0) / zero;
+        complex_double offset = std::sqrt(inverted * inverted - centre * centre);
+        analog.zeros.push_back(inverted + offset);
+        analog.zeros.push_back(inverted - offset);
+    }
+    for (const complex_double & pole : prototype.poles) {
+        complex_double inverted = (bandwidth / 2.0) / pole;
+        complex_double offset = std::sqrt(inverted * inverted - centre * centre);
+        analog.poles.push_back(inverted + offset);
+        analog.poles.push_back(inverted - offset);
+    }
+    // zeros at infinity move to +/- j * centre (the notch)
+    int degree = (int) prototype.poles.size() - (int) prototype.zeros.size();
+    for (int i = 0; i < degree; ++i) {
+        analog.zeros.push_back(complex_double(0.0, centre));
+        analog.zeros.push_back(complex_double(0.0, -centre));
+    }
+
+    complex_double gain_ratio = 1.0;
+    for (const complex_double & zero : prototype.zeros) {
+        gain_ratio *= -zero;
+    }
+    for (const complex_double & pole : prototype.poles) {
+        gain_ratio /= -pole;
+    }
+    analog.gain = prototype.gain * gain_ratio.real();
+    return analog;
+}
+
+double prewarp_frequency(double frequency, double sampling_frequency) {
+    /* Converts a digital frequency (Hz) into the analog frequency (rad/s) that the bilinear transform maps onto it
+     *
+     * param frequency: Frequency in Hz (between 0 and sampling_frequency / 2)
+     * param sampling_frequency: Frequency at which the data is sampled
+     * return: Prewarped analog frequency in rad/s
+     */
+
+    if (frequency <= 0.0 || frequency >= sampling_frequency / 2.0) {
+        throw std::runtime_error("Cut off frequencies must be between 0 Hz and half of the sample rate!");
+    }
+    return 2.0 * sampling_frequency * tan(M_PI * frequency / sampling_frequency);
+}
+
+ZerosPolesGain bilinear_transform(const ZerosPolesGain& analog, double sampling_frequency) {
+    /* Maps an analog filter onto a digital filter using s = 2 * fs * (z - 1) / (z + 1) */
+
+    double fs_2 = 2.0 * sampling_frequency;
+    ZerosPolesGain digital;
+    complex_double gain_ratio = 1.0;
+    for (const complex_double & zero : analog.zeros) {
+        digital.zeros.push_back((fs_2 + zero) / (fs_2 - zero));
+        gain_ratio *= fs_2 - zero;
+    }
+    for (const complex_double & pole : analog.poles) {
+        digital.poles.push_back((fs_2 + pole) / (fs_2 - pole));
+        gain_ratio /= fs_2 - pole;
+    }
+    // zeros at infinity move to the Nyquist frequency (z = -1)
+    int degree = (int) analog.poles.size() - (int) analog.zeros.size();
+    for (int i = 0; i < degree; ++i) {
+        digital.zeros.push_back(-1.0);
+    }
+    digital.gain = analog.gain * gain_ratio.real();
+    return digital;
+}
+
+static bool is_real_root(const complex_double & root) {
+    /* Checks if a root is (numerically) on the real axis */
+
+    return fabs(root.imag()) <= 1e-10 * std::max(1.0, std::abs(root));
+}
+
+static int take_nearest_root(std::vector<complex_double>& roots, const complex_double & target, bool real_only) {
+    /* Finds the root nearest to the target (returns -1 if there are no matching roots) */
+
+    int nearest = -1;
+    for (int i = 0; i < roots.size(); ++i) {
+        if (real_only && !is_real_root(roots[i])) continue;
+        if (nearest == -1 || std::abs(roots[i] - target) < std::abs(roots[nearest] - target)) {
+            nearest = i;
+        }
+    }
+    return nearest;
+}
+
+static complex_double remove_root(std::vector<complex_double>& roots, int index) {
+    /* Removes a root (and its conjugate if it is complex), returning the removed root */
+
+    complex_double root = roots[index];
+    roots.erase(roots.begin() + index);
+    if (!is_real_root(root)) {
+        int conjugate = take_nearest_root(roots, std::conj(root), false);
+        roots.erase(roots.begin() + conjugate);
+    }
+    return root;
+}
+
+std::vector<SecondOrderSection> convert_to_sections(const ZerosPolesGain& digital) {
+    /* Groups the zeros and poles of a digital filter into second order sections
+     *
+     * Poles closest to the unit circle are paired with their nearest zeros and placed last, which
+     * keeps the intermediate signal levels of the cascade under control.
+     *
+     * param digital: Zeros, poles and gain of a digital filter (same number of zeros and poles)
+     * return: Second order sections (the gain is applied to the first section)
+     */
+
+    std::vector<complex_double> zeros = digital.zeros;
+    std::vector<complex_double> poles = digital.poles;
+    // every pole needs a zero for the sections to be proper
+    while (zeros.size() < poles.size()) {
+        zeros.push_back(-1.0);
+    }
+
+    std::vector<SecondOrderSection> sections;
+    auto make_section = [](
+        complex_double zero_1, complex_double zero_2, complex_double pole_1, complex_double pole_2, bool first_order
+    ) {
+        SecondOrderSection section = {};
+        if (first_order) {
+            section.b0 = 1.0;
+            section.b1 = -zero_1.real();
+            section.a1 = -pole_1.real();
+        }
+        else {
+            section.b0 = 1.0;
+            section.b1 = -(zero_1 + zero_2).real();
+            section.b2 = (zero_1 * zero_2).real();
+            section.a1 = -(pole_1 + pole_2).real();
+            section.a2 = (pole_1 * pole_2).real();
+        }
+        return section;
+    };
+
+    // an odd number of real poles leaves a single real pole for a first order section
+    int num_real_poles = 0;
+    for (const complex_double & pole : poles) {
+        if (is_real_root(pole)) ++num_real_poles;
+    }
+    if (num_real_poles % 2 == 1) {
+        int pole_index = 0;
+        for (int i = 0; i < poles.size(); ++i) {
+            if (is_real_root(poles[i]) && (!is_real_root(poles[pole_index]) || std::abs(poles[i]) < std::abs(poles[pole_index]))) {
+                pole_index = i;
+            }
+        }
+        complex_double pole = complex_double(poles[pole_index].real(), 0.0);
+        poles.erase(poles.begin() + pole_index);
+        int zero_index = take_nearest_root(zeros, pole, true);
+        complex_double zero = complex_double(zeros[zero_index].real(), 0.0);
+        zeros.erase(zeros.begin() + zero_index);
+        sections.push_back(make_section(zero, 0.0, pole, 0.0, true));
+    }
+
+    // the remaining poles are paired up, starting with the furthest from the unit circle
+    while (!poles.empty()) {
+        int pole_index = 0;
+        for (int i = 1; i < poles.size(); ++i) {
+            if (std::abs(poles[i]) < std::abs(poles[pole_index])) pole_index = i;
+        }
+        complex_double pole_1 = poles[pole_index];
+        complex_double pole_2;
+        if (is_real_root(pole_1)) {
+            poles.erase(poles.begin() + pole_index);
+            pole_1 = complex_double(pole_1.real(), 0.0);
+            pole_2 = complex_double(poles[take_nearest_root(poles, pole_1, true)].real(), 0.0);
+            poles.erase(poles.begin() + take_nearest_root(poles, pole_2, true));
+        }
+        else {
+            pole_1 = remove_root(poles, pole_index);
+            pole_2 = std::conj(pole_1);
+        }
+
+        complex_double zero_1 = remove_root(zeros, take_nearest_root(zeros, pole_1, false));
+        complex_double zero_2;
+        if (is_real_root(zero_1)) {
+            zero_1 = complex_double(zero_1.real(), 0.0);
+            int zero_index = take_nearest_root(zeros, pole_1, true);
+            zero_2 = complex_double(zeros[zero_index].real(), 0.0);
+            zeros.erase(zeros.begin() + zero_index);
+        }
+        else {
+            zero_2 = std::conj(zero_1);
+        }
+        sections.push_back(make_section(zero_1, zero_2, pole_1, pole_2, false));
+    }
+
+    if (sections.empty()) {
+        // a filter with no poles is only a gain
+        sections.push_back(make_section(0.0, 0.0, 0.0, 0.0, true));
+    }
+    sections[0].b0 *= digital.gain;
+    sections[0].b1 *= digital.gain;
+    sections[0].b2 *= digital.gain;
+    return sections;
+}
+
+#endif
@@ -0,0 +1,40 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef IIR_DESIGN_HPP
+#define IIR_DESIGN_HPP
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+
+#ifndef IIR_FILTER_HPP
+#include "classes/InfiniteImpulseResponseFilter.hpp"
+#endif
+
+typedef struct zeros_poles_gain {
+    std::vector<std::complex<double>> zeros;
+    std::vector<std::complex<double>> poles;
+    double gain;
+} ZerosPolesGain;
+
+ZerosPolesGain design_analog_prototype(
+    IIRDesign design, int order, double passband_ripple, double stopband_attenuation
+);
+
+ZerosPolesGain transform_to_low_pass(const ZerosPolesGain& prototype, double cut_off);
+ZerosPolesGain transform_to_high_pass(const ZerosPolesGain& prototype, double cut_off);
+ZerosPolesGain transform_to_band_pass(const ZerosPolesGain& prototype, double centre, double bandwidth);
+ZerosPolesGain transform_to_band_stop(const ZerosPolesGain& prototype, double centre, double bandwidth);
+
+double prewarp_frequency(double frequency, double sampling_frequency);
+ZerosPolesGain bilinear_transform(const ZerosPolesGain& analog, double sampling_frequency);
+
+std::vector<SecondOrderSection> convert_to_sections(const ZerosPolesGain& digital);
+
+#endif //IIR_DESIGN_HPP
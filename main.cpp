@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <string>
 #include <chrono>
+#include <type_traits>
 
 #ifndef DATA_HANDLER_HPP
 #include "data_handler.hpp"
@@ -21,6 +22,26 @@
 #include "classes/FiniteImpulseResponseFilter.hpp"
 #endif
 
+#ifndef COEFFICIENT_CACHE_HPP
+#include "classes/CoefficientCache.hpp"
+#endif
+
+#ifndef MULTICHANNEL_FILTER_HPP
+#include "classes/MultichannelFilter.hpp"
+#endif
+
+#ifndef MAPPED_WAV_FILE_HPP
+#include "classes/MappedWavFile.hpp"
+#endif
+
+#ifndef WAV_STREAM_HPP
+#include "classes/WavStream.hpp"
+#endif
+
+#ifndef BENCHMARKS_HPP
+#include "benchmarks.hpp"
+#endif
+
 using namespace std;
 
 using chrono::high_resolution_clock;
@@ -30,20 +51,59 @@ using chrono::milliseconds;
 
 typedef vector<vector<double>> vector_2d_double;
 
-tuple<vector<double>, vector_2d_double> run_experiment(
+template <typename Sample>
+SamplePrecision get_sample_precision() {
+    /*
+     * return: Precision that filters are applied at for signals held as Sample (float or double)
+     */
+    return is_same<Sample, float>::value ? single_precision : double_precision;
+}
+
+template <typename Sample>
+tuple<vector<vector<Sample>>, double> load_wav_channels(const string& wav_path) {
+    /* Reads a 16 bit WAV file into normalised float or double channels
+     *
+     * The file is memory mapped and deinterleaved straight into the channels (no 16 bit copy of the file is made).
+     *
+     * param wav_path: Name of the WAV file (.wav is added if missing)
+     * return: Channels of the signal and its sample rate
+     */
+
+    cout << endl << "Reading WAV file..." << endl;
+    MappedWavFile wav_file = MappedWavFile(wav_path);
+    size_t num_frames = wav_file.get_num_frames();
+    vector<vector<Sample>> channels(wav_file.get_num_channels(), vector<Sample>(num_frames));
+    vector<Sample *> channel_pointers;
+    for (vector<Sample>& channel : channels) channel_pointers.push_back(channel.data());
+    wav_file.read_channels(0, num_frames, channel_pointers.data());
+
+    cout << wav_file.get_num_channels() << " channel(s), " << num_frames << " frames at "
+         << wav_file.get_sample_rate() << " Hz" << endl;
+    return make_tuple(std::move(channels), 1.0 * wav_file.get_sample_rate());
+}
+
+template <typename Sample>
+tuple<vector<double>, vector<vector<Sample>>> run_experiment(
     FilterType filter_type,
     double sampling_frequency,
     const vector<double>& cut_off_frequencies,
-    const vector_2d_double& wave_data,
+    const vector<vector<Sample>>& wave_data,
     int num_taps = 50  // total number of coefficients (N) = (2 * num_taps) + 1
 ) {
-    /* Runs an experiment (applying an FIR filter to inputted data). */
+    /* Runs an experiment (applying an FIR filter to inputted data).
+     *
+     * Float signals are filtered with the single precision kernels, so no double copy of the signal is made.
+     */
 
     cout << endl << "Calculating coefficients..." << endl;
     auto t1 = high_resolution_clock::now();
-    // initialises a low pass FIR filter
-    FiniteImpulseResponseFilter filter = FiniteImpulseResponseFilter(
-        filter_type, sampling_frequency, {cut_off_frequencies}, num_taps
+    // long filters are faster to apply using FFT convolution
+    ConvolutionMode convolution_mode = ((2 * num_taps) + 1 >= fft_convolution_threshold) ? overlap_save : direct_form;
+    // initialises an FIR filter (filters with the same specification are only designed once)
+    FiniteImpulseResponseFilter filter = CoefficientCache::get_instance().create_filter(
+        {filter_type, sampling_frequency, cut_off_frequencies, num_taps, rectangular},
+        convolution_mode,
+        get_sample_precision<Sample>()
     );
     auto t2 = high_resolution_clock::now();
 
@@ -52,31 +112,29 @@ tuple<vector<double>, vector_2d_double> run_experiment(
 
     cout << "Filtering signal..." << endl;
     t1 = high_resolution_clock::now();
-    // the filter is applied to the generated signal and saved to a vector
-    vector_2d_double filtered_data;
-    filtered_data.resize(wave_data.size());
-    for (int i = 0; i < wave_data.size(); ++i) {
-        for (double data_sample : wave_data[i]) {
-            filtered_data[i].push_back(filter.apply_filter(data_sample));
-        }
-    }
+    // each channel gets its own copy of the filter (no shared state) and channels are filtered in parallel
+    MultichannelFilter multichannel_filter = MultichannelFilter(filter, (int) wave_data.size());
+    vector<vector<Sample>> filtered_data;
+    multichannel_filter.apply_filter_block(wave_data, filtered_data);
     t2 = high_resolution_clock::now();
 
     duration<double, milli> filter_time = t2 - t1;
     cout << "Took " << filter_time.count() << " ms" << endl;
 
-    return make_tuple(filter.get_coefficients(), filtered_data);
+    return make_tuple(filter.get_coefficients(), std::move(filtered_data));
 }
 
+template <typename Sample>
 void run_experiment_wrapper(
     const string& file_name,
     FilterType filter_type,
     double sample_rate,
     const vector<double>& cut_off_frequencies,
-    const vector<double>& x_vector,
-    const vector_2d_double& data_vector,
+    const TimeAxis& time_axis,
+    const vector<vector<Sample>>& data_vector,
     bool is_wav = false,
-    int num_taps = 50
+    int num_taps = 50,
+    OutputFormat output_format = csv_output
 ) {
     /* Wrapper function for run_experiment() - Records results produced by run_experiment(). */
 
@@ -88,7 +146,7 @@ void run_experiment_wrapper(
     else throw runtime_error("Unknown filter type!");
 
     vector<double> coeffs;
-    vector_2d_double filtered_data;
+    vector<vector<Sample>> filtered_data;
     // runs low pass filter on inputted data
     tie(coeffs, filtered_data) = run_experiment(
         filter_type,
@@ -98,22 +156,13 @@ void run_experiment_wrapper(
         num_taps
     );
 
-    // generates an index vector for the filter coefficients
-    vector<double> x_axis;
-    for (int i = 0; i < coeffs.size(); ++i) {
-        x_axis.push_back(double(i));
-    }
-    // writes the filter coefficients to a .csv file
-    string coeff_file_name = filter_type_initials + " coefficients for " + file_name + ".csv";
-    write_csv_file(coeff_file_name, x_axis, {coeffs});
+    // writes the filter coefficients to a .csv (or .sig) file, with the coefficient number as the x-axis
+    string coeff_file_name = filter_type_initials + " coefficients for " + file_name;
+    write_output_file(coeff_file_name, make_index_axis(), {coeffs}, output_format);
 
     string filtered_file_name = filter_type_initials + " " + file_name;
-    // the filtered signal is written to a .csv file
-    write_csv_file(
-        (filtered_file_name + ".csv"),
-        x_vector,
-        filtered_data
-    );
+    // the filtered signal is written to a .csv (or .sig) file
+    write_output_file(filtered_file_name, time_axis, filtered_data, output_format);
 
     if (is_wav) {
         // only asks if the user wants to write WAV file if they inputted a WAV file
@@ -136,9 +185,58 @@ void run_experiment_wrapper(
     }
 }
 
+void check_regenerated_filter(ConvolutionMode convolution_mode) {
+    /* Checks that a filter whose coefficients are generated again matches a newly constructed filter
+     *
+     * param convolution_mode: How the filters are applied (direct_form, overlap_add or overlap_save)
+     */
+
+    double sampling_frequency = 1000.0;
+    vector<double> signal(2000);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = sin(2.0 * M_PI * 30.0 * i / sampling_frequency) + 0.5 * sin(2.0 * M_PI * 300.0 * i / sampling_frequency);
+    }
+
+    // low pass filter that is changed into a high pass filter
+    FiniteImpulseResponseFilter regenerated_filter = FiniteImpulseResponseFilter(low_pass, sampling_frequency, {100.0}, 50);
+    regenerated_filter.set_convolution_mode(convolution_mode);
+    regenerated_filter.generate_coefficients(high_pass, {200.0});
+    FiniteImpulseResponseFilter new_filter = FiniteImpulseResponseFilter(high_pass, sampling_frequency, {200.0}, 50);
+    new_filter.set_convolution_mode(convolution_mode);
+
+    vector<double> block_output(signal.size()), new_output(signal.size());
+    regenerated_filter.apply_filter_block(signal.data(), block_output.data(), signal.size());
+    new_filter.apply_filter_block(signal.data(), new_output.data(), signal.size());
+    // the per-sample outputs continue from the block, so the filter is reset first
+    regenerated_filter.generate_coefficients(high_pass, {200.0});
+
+    double max_block_difference = 0.0;
+    double max_sample_difference = 0.0;
+    for (size_t i = 0; i < signal.size(); ++i) {
+        double sample_output = regenerated_filter.apply_filter(signal[i]);
+        max_block_difference = max(max_block_difference, fabs(block_output[i] - new_output[i]));
+        max_sample_difference = max(max_sample_difference, fabs(block_output[i] - sample_output));
+    }
+
+    string mode_name = "direct form";
+    if (convolution_mode == overlap_save) mode_name = "overlap-save";
+    else if (convolution_mode == overlap_add) mode_name = "overlap-add";
+    cout << "Regenerated " << mode_name << " filter: max difference from a new filter = " << max_block_difference
+         << ", max block/sample difference = " << max_sample_difference
+         << ((max_block_difference < 1e-9 && max_sample_difference < 1e-9) ? " (passed)" : " (FAILED)") << endl;
+}
+
 void run_tests() {
     /* This function runs various experiments to help with testing the program */
 
+    /* Filter consistency checks */
+    /* ======================================================== */
+
+    cout << "Filter consistency checks" << endl;
+    check_regenerated_filter(direct_form);
+    check_regenerated_filter(overlap_save);
+    check_regenerated_filter(overlap_add);
+
     /* Generated sine signal */
     /* ======================================================== */
 
@@ -150,7 +248,7 @@ void run_tests() {
     vector<double> amplitudes = {1.0, 0.1, 0.01};
     vector<double> phase_offsets = {0.0, 0.0, 0.0};
 
-    vector<double> sine_x_vector, sine_wave_data;
+    vector<double> sine_wave_data;
     double sine_sampling_frequency;
     // generates a sine based signal based on inputted frequencies
     tie(sine_wave_data, sine_sampling_frequency) = generate_sine_signal(
@@ -161,17 +259,15 @@ void run_tests() {
         begin_value,
         end_value
     );
-    // creates x-axis for data (measured in seconds)
-    for (int i = 0; i < sine_wave_data.size(); ++i) {
-        sine_x_vector.push_back(double(i / sine_sampling_frequency));
-    }
+    // x-axis for data (measured in seconds), each time is calculated as it is written
+    TimeAxis sine_time_axis = make_time_axis(sine_sampling_frequency);
     cout << "Sine sample rate = " << sine_sampling_frequency << endl;
 
     string sine_file_name = "noisy_sine";
     // writes the generated data to a .csv file
     write_csv_file(
         (sine_file_name + ".csv"),
-        sine_x_vector,
+        sine_time_axis,
         {sine_wave_data}  // only 1 channel
     );
 
@@ -186,8 +282,8 @@ void run_tests() {
         low_pass,
         sine_sampling_frequency,
         {5.0},
-        sine_x_vector,
-        {sine_wave_data}
+        sine_time_axis,
+        vector_2d_double{sine_wave_data}  // only 1 channel
     );
 
     /* High pass experiment */
@@ -198,8 +294,8 @@ void run_tests() {
         high_pass,
         sine_sampling_frequency,
         {15.0},
-        sine_x_vector,
-        {sine_wave_data}
+        sine_time_axis,
+        vector_2d_double{sine_wave_data}  // only 1 channel
     );
 
     /* Band pass experiment */
@@ -210,8 +306,8 @@ void run_tests() {
         band_pass,
         sine_sampling_frequency,
         {5.0, 15.0},
-        sine_x_vector,
-        {sine_wave_data}
+        sine_time_axis,
+        vector_2d_double{sine_wave_data}  // only 1 channel
     );
 
     /* Inputted WAV file */
@@ -222,16 +318,12 @@ void run_tests() {
     vector_2d_double wave_data = convert_data_to_double(wav_file.data);
     double sampling_frequency = 1.0 * wav_file.sample_rate;
 
-    // generates x-axis for .csv file
-    vector<double> x_vector;
-    // all channels should have the same length
-    for (int i = 0; i < wave_data[0].size(); ++i) {
-        x_vector.push_back(double(i / sampling_frequency));
-    }
+    // x-axis for .csv file
+    TimeAxis time_axis = make_time_axis(sampling_frequency);
     string file_name = "test_recording";
 
     // writes WAV data to .csv file
-    write_csv_file((file_name + ".csv"), x_vector, wave_data);
+    write_csv_file((file_name + ".csv"), time_axis, wave_data);
 
     /* Runs experiments on WAV file */
     /* ---------------------------- */
@@ -243,8 +335,8 @@ void run_tests() {
         low_pass,
         sampling_frequency,
         {150.0},
-        x_vector,
-        {wave_data},
+        time_axis,
+        wave_data,
         true
     );
 
@@ -255,8 +347,8 @@ void run_tests() {
         high_pass,
         sampling_frequency,
         {3500.0},
-        x_vector,
-        {wave_data},
+        time_axis,
+        wave_data,
         true
     );
 
@@ -267,21 +359,27 @@ void run_tests() {
         band_pass,
         sampling_frequency,
         {200.0, 3000.0},
-        x_vector,
-        {wave_data},
+        time_axis,
+        wave_data,
         true
     );
 }
 
-void debug_mode() {
-    /* Somewhat hidden menu for testing the program and converting WAV files to CSV */
+void debug_mode(string& coefficient_cache_file) {
+    /* Somewhat hidden menu for testing the program and converting WAV files to CSV
+     *
+     * param coefficient_cache_file: File that filter designs are saved to when the program quits (empty for none)
+     */
 
     cout << "Debug mode" << endl;
     cout << "=======================================" << endl;
 
     while(true) {
         cout << endl << "Please select one of the following:" << endl;
-        cout << "1. Convert WAV to CSV" << endl << "2. Run tests" << endl << "3. Back to main menu" << endl;
+        cout << "1. Convert WAV to CSV (or binary signal file)" << endl << "2. Run tests" << endl << "3. Run benchmarks" << endl
+             << "4. Resample WAV file" << endl << "5. Filter WAV file in blocks (for long recordings)" << endl
+             << "6. Use a coefficient cache file (currently " << (coefficient_cache_file.empty() ? "none" : coefficient_cache_file)
+             << ")" << endl << "7. Back to main menu" << endl;
         int selection;
         cin >> selection;
 
@@ -295,25 +393,25 @@ void debug_mode() {
 
                 try {
                     // reads wav file (can throw exception)
-                    WavFile wav_file = read_wav(wav_path);
+                    vector_2d_double wave_data;
+                    double sample_rate;
+                    tie(wave_data, sample_rate) = load_wav_channels<double>(wav_path);
                     // removes .wav suffix
                     if (wav_path.substr(wav_path.length() - 4, 4) == ".wav") {
                         wav_path.erase(wav_path.end() - 4, wav_path.end());
                     }
 
-                    // converts data and sample rate to doubles
-                    vector_2d_double wave_data = convert_data_to_double(wav_file.data);
-                    double sample_rate = 1.0 * wav_file.sample_rate;
+                    // x-axis for .csv file
+                    TimeAxis time_axis = make_time_axis(sample_rate);
 
-                    // generates x-axis for .csv file
-                    vector<double> x_vector;
-                    // all channels should have the same length
-                    for (int i = 0; i < wave_data[0].size(); ++i) {
-                        x_vector.push_back(double(i / sample_rate));
-                    }
+                    cout << "Please select an output format:" << endl
+                         << "1. CSV (.csv)" << endl << "2. Binary signal file (.sig)" << endl;
+                    int format_selection;
+                    cin >> format_selection;
+                    OutputFormat output_format = (format_selection == 2) ? signal_output : csv_output;
 
-                    // writes WAV data to csv file (can throw exception)
-                    write_csv_file((wav_path + ".csv"), x_vector, wave_data);
+                    // writes WAV data to csv (or signal) file (can throw exception)
+                    write_output_file(wav_path, time_axis, wave_data, output_format);
                 }
                 catch (exception &e) {
                     // exception occurs when file is not found, or is inaccessible
@@ -333,6 +431,109 @@ void debug_mode() {
                 break;
             }
             case 3:
+                run_benchmarks();
+                break;
+            case 4: {
+                cout << "Please enter name of WAV file (including .wav):" << endl;
+                string wav_path;
+                cin.ignore();
+                getline(cin, wav_path, '\n');
+                cout << "Please enter the new sample rate (e.g. 48000):" << endl;
+                int output_sample_rate;
+                cin >> output_sample_rate;
+
+                try {
+                    // the resampled file is saved next to the original (e.g. recording_48000.wav)
+                    string output_path = wav_path;
+                    if (output_path.length() >= 4 && output_path.substr(output_path.length() - 4, 4) == ".wav") {
+                        output_path.erase(output_path.end() - 4, output_path.end());
+                    }
+                    output_path += "_" + to_string(output_sample_rate) + ".wav";
+
+                    auto t1 = high_resolution_clock::now();
+                    // streams the file through the resampler (can throw exception)
+                    resample_wav_file(wav_path, output_path, output_sample_rate);
+                    auto t2 = high_resolution_clock::now();
+                    duration<double, milli> ms_double = t2 - t1;
+                    cout << "Saved " << output_path << " (" << ms_double.count() << "ms)" << endl;
+                }
+                catch (exception &e) {
+                    // exception occurs when file is not found, is inaccessible or the sample rate is invalid
+                    cout << "Exception occurred: " << e.what() << endl;
+                }
+                break;
+            }
+            case 5: {
+                cout << "Please enter name of WAV file (including .wav):" << endl;
+                string wav_path;
+                cin.ignore();
+                getline(cin, wav_path, '\n');
+                cout << "Please select a filter:" << endl
+                     << "1. Low pass FIR" << endl << "2. High pass FIR" << endl << "3. Band pass FIR" << endl;
+                int filter_selection;
+                cin >> filter_selection;
+                if (filter_selection < 1 || filter_selection > 3) {
+                    cout << "Invalid choice!" << endl;
+                    break;
+                }
+                FilterType filter_type = (filter_selection == 1) ? low_pass : (filter_selection == 2) ? high_pass : band_pass;
+                vector<double> cut_off_frequencies(filter_type == band_pass ? 2 : 1);
+                for (size_t i = 0; i < cut_off_frequencies.size(); ++i) {
+                    cout << "Please enter cut-off frequency " << i + 1 << " in Hz:" << endl;
+                    cin >> cut_off_frequencies[i];
+                }
+
+                try {
+                    // the filtered file is saved next to the original (e.g. "LP recording.wav")
+                    string file_name = wav_path;
+                    if (file_name.length() >= 4 && file_name.substr(file_name.length() - 4, 4) == ".wav") {
+                        file_name.erase(file_name.end() - 4, file_name.end());
+                    }
+                    string filter_type_initials = (filter_type == low_pass) ? "LP" : (filter_type == high_pass) ? "HP" : "BP";
+                    string output_path = filter_type_initials + " " + file_name + ".wav";
+
+                    auto t1 = high_resolution_clock::now();
+                    // only the header is read to design the filter (can throw exception)
+                    double sample_rate = WavReader(wav_path).get_sample_rate();
+                    FiniteImpulseResponseFilter filter = CoefficientCache::get_instance().create_filter(
+                        {filter_type, sample_rate, cut_off_frequencies, 50, rectangular}
+                    );
+                    // reads, filters and writes one block at a time, so memory use doesn't depend on the file length
+                    filter_wav_file(wav_path, output_path, filter);
+                    auto t2 = high_resolution_clock::now();
+                    duration<double, milli> ms_double = t2 - t1;
+                    cout << "Saved " << output_path << " (" << ms_double.count() << "ms)" << endl;
+                }
+                catch (exception &e) {
+                    // exception occurs when file is not found, is inaccessible or the cut-off frequencies are invalid
+                    cout << "Exception occurred: " << e.what() << endl;
+                }
+                break;
+            }
+            case 6: {
+                cout << "Please enter name of the coefficient cache file (leave empty to stop using one):" << endl;
+                string cache_path;
+                cin.ignore();
+                getline(cin, cache_path, '\n');
+                coefficient_cache_file = cache_path;
+                if (cache_path.empty()) break;
+
+                try {
+                    // filters designed by previous runs are loaded instead of being designed again
+                    if (CoefficientCache::get_instance().load_file(cache_path)) {
+                        cout << "Loaded filter designs from " << cache_path << endl;
+                    }
+                    else {
+                        cout << cache_path << " will be created when the program quits" << endl;
+                    }
+                }
+                catch (exception &e) {
+                    // exception occurs when the file is corrupted (it is replaced when the program quits)
+                    cout << "Exception occurred: " << e.what() << endl;
+                }
+                break;
+            }
+            case 7:
                 // allows the while true loop to be broken
                 quit = true;
                 break;
@@ -340,24 +541,30 @@ void debug_mode() {
                 cout << "Invalid choice! Please try again." << endl;
                 break;
         }
-        // quit = true when user selects option 3
+        // quit = true when user selects option 7
         if (quit) break;
     }
 }
 
-void filtering_menu(vector_2d_double& data_vector, double sample_rate, const string& file_name, bool is_wav = false) {
-    /* Menu for filtering a signal */
+template <typename Sample>
+void filtering_menu(
+    const vector<vector<Sample>>& data_vector, const TimeAxis& time_axis, const string& file_name, bool is_wav = false
+) {
+    /* Menu for filtering a signal (held as floats when single precision was chosen before it was loaded)
+     *
+     * param time_axis: Sample rate and start time of the signal (x-axis for .csv files)
+     */
+
+    double sample_rate = time_axis.sample_rate;
 
-    // generates x-axis for .csv file
-    vector<double> x_vector;
-    // all channels should have the same length
-    for (int i = 0; i < data_vector[0].size(); ++i) {
-        x_vector.push_back(double(i / sample_rate));
-    }
+    // results are saved as .csv files unless binary signal files are selected
+    OutputFormat output_format = csv_output;
 
     while (true) {
         cout << endl << "Please select a filter:" << endl;
-        cout << "1. Low pass FIR" << endl << "2. High pass FIR" << endl << "3. Band pass FIR" << endl << "4. Go back" << endl;
+        cout << "1. Low pass FIR" << endl << "2. High pass FIR" << endl << "3. Band pass FIR" << endl << "4. Go back" << endl
+             << "5. Change output format (currently " << (output_format == csv_output ? "CSV" : "binary signal file")
+             << ")" << endl;
         int selection;
         cin >> selection;
         bool quit = false;
@@ -375,9 +582,11 @@ void filtering_menu(vector_2d_double& data_vector, double sample_rate, const str
                     low_pass,
                     sample_rate,
                     {cut_off},
-                    x_vector,
-                    {data_vector},
-                    is_wav
+                    time_axis,
+                    data_vector,
+                    is_wav,
+                    50,
+                    output_format
                 );
                 break;
             }
@@ -393,9 +602,11 @@ void filtering_menu(vector_2d_double& data_vector, double sample_rate, const str
                     high_pass,
                     sample_rate,
                     {cut_off},
-                    x_vector,
-                    {data_vector},
-                    is_wav
+                    time_axis,
+                    data_vector,
+                    is_wav,
+                    50,
+                    output_format
                 );
                 break;
             }
@@ -414,9 +625,11 @@ void filtering_menu(vector_2d_double& data_vector, double sample_rate, const str
                     band_pass,
                     sample_rate,
                     {cut_off1, cut_off2},
-                    x_vector,
-                    {data_vector},
-                    is_wav
+                    time_axis,
+                    data_vector,
+                    is_wav,
+                    50,
+                    output_format
                 );
                 break;
             }
@@ -424,6 +637,10 @@ void filtering_menu(vector_2d_double& data_vector, double sample_rate, const str
                 // allows the while true loop to be broken
                 quit = true;
                 break;
+            case 5:
+                // binary signal files are smaller and load without parsing
+                output_format = (output_format == csv_output) ? signal_output : csv_output;
+                break;
             default:
                 cout << "Invalid choice! Please try again." << endl;
                 break;
@@ -433,13 +650,65 @@ void filtering_menu(vector_2d_double& data_vector, double sample_rate, const str
     }
 }
 
+template <typename Sample>
+void open_wav_file(string wav_path) {
+    /* Reads a WAV file as float or double samples and opens the filtering menu for it
+     *
+     * param wav_path: Name of the WAV file (can throw exception if it is missing or inaccessible)
+     */
+
+    vector<vector<Sample>> wave_data;
+    double sampling_frequency;
+    tie(wave_data, sampling_frequency) = load_wav_channels<Sample>(wav_path);
+
+    // removes .wav suffix
+    if (wav_path.substr(wav_path.length() - 4, 4) == ".wav") {
+        wav_path.erase(wav_path.end() - 4, wav_path.end());
+    }
+    filtering_menu(wave_data, make_time_axis(sampling_frequency), wav_path, true);
+}
+
+template <typename Sample>
+void open_signal_file(string csv_path) {
+    /* Reads a CSV (or binary signal) file as float or double samples and opens the filtering menu for it
+     *
+     * param csv_path: Name of the .csv or .sig file (can throw exception if it is missing or invalid)
+     */
+
+    vector<vector<Sample>> wave_data;
+    TimeAxis time_axis;
+    if (csv_path.length() >= 4 && csv_path.substr(csv_path.length() - 4, 4) == ".sig") {
+        // binary signal files store the sample rate and start time instead of an x-axis
+        tie(wave_data, time_axis) = read_signal_file<Sample>(csv_path);
+        csv_path.erase(csv_path.end() - 4, csv_path.end());
+    }
+    else {
+        // reads all but the first column (x-axis) of the csv file
+        // sample rate = 1 / time period (of the first two rows)
+        tie(wave_data, time_axis) = read_csv_signal<Sample>(csv_path);
+
+        // removes .csv suffix
+        if (csv_path.substr(csv_path.length() - 4, 4) == ".csv") {
+            csv_path.erase(csv_path.end() - 4, csv_path.end());
+        }
+    }
+    filtering_menu(wave_data, time_axis, csv_path, false);
+}
+
 int main() {
     cout << "Digital signal filtering tool" << endl;
     cout << "=======================================" << endl;
 
+    // designs are only saved between runs if a cache file is chosen in debug mode
+    string coefficient_cache_file;
+    // signals are loaded, filtered and saved as doubles unless single precision is selected
+    SamplePrecision precision = double_precision;
+
     while (true) {
         cout << endl << "Please select one of the following:" << endl;
-        cout << "1. Read WAV file" << endl << "2. Read CSV file" << endl << "3. Quit" << endl;
+        cout << "1. Read WAV file" << endl << "2. Read CSV (or binary signal) file" << endl << "3. Quit" << endl
+             << "5. Change precision (currently " << (precision == double_precision ? "double" : "single")
+             << ")" << endl;
         int selection;
         cin >> selection;
 
@@ -453,17 +722,8 @@ int main() {
 
                 try {
                     // reads wav file (can throw exception)
-                    WavFile wav_file = read_wav(wav_path);
-
-                    // converts data and sample rate to doubles
-                    vector_2d_double wave_data = convert_data_to_double(wav_file.data);
-                    double sampling_frequency = 1.0 * wav_file.sample_rate;
-
-                    // removes .wav suffix
-                    if (wav_path.substr(wav_path.length() - 4, 4) == ".wav") {
-                        wav_path.erase(wav_path.end() - 4, wav_path.end());
-                    }
-                    filtering_menu(wave_data, sampling_frequency, wav_path, true);
+                    if (precision == single_precision) open_wav_file<float>(wav_path);
+                    else open_wav_file<double>(wav_path);
                 }
                 catch (exception &e) {
                     // exception occurs when file is not found, or is inaccessible
@@ -473,27 +733,15 @@ int main() {
                 break;
             }
             case 2: {
-                cout << "Please enter name of CSV file (including .csv):" << endl;
+                cout << "Please enter name of CSV file (including .csv or .sig):" << endl;
                 string csv_path;
                 cin.ignore();
                 getline(cin, csv_path, '\n');
 
                 try {
-                    // reads csv file into a 2D vector (can throw exception)
-                    vector_2d_double csv_data = read_csv_file(csv_path);
-                    vector_2d_double wave_data;
-                    // selects all but the first column (x-axis) in csv file
-                    for (int i = 1; i < csv_data.size(); ++i) {
-                        wave_data.push_back(csv_data[i]);
-                    }
-                    // sample rate = 1 / time period
-                    double sampling_frequency = 1.0 / (csv_data[0][1] - csv_data[0][0]);
-
-                    // removes .csv suffix
-                    if (csv_path.substr(csv_path.length() - 4, 4) == ".csv") {
-                        csv_path.erase(csv_path.end() - 4, csv_path.end());
-                    }
-                    filtering_menu(wave_data, sampling_frequency, csv_path, false);
+                    // reads csv (or signal) file (can throw exception)
+                    if (precision == single_precision) open_signal_file<float>(csv_path);
+                    else open_signal_file<double>(csv_path);
                 }
                 catch (exception &e) {
                     // exception occurs when file is not found, or is inaccessible
@@ -507,7 +755,11 @@ int main() {
                 quit = true;
                 break;
             case 4:
-                debug_mode();
+                debug_mode(coefficient_cache_file);
+                break;
+            case 5:
+                // single precision is accurate enough for 16 bit audio, filters faster and halves the memory used
+                precision = (precision == double_precision) ? single_precision : double_precision;
                 break;
             default:
                 cout << "Invalid choice! Please try again." << endl;
@@ -516,5 +768,15 @@ int main() {
         // quit = true when user selects option 3
         if (quit) break;
     }
+
+    if (!coefficient_cache_file.empty() && CoefficientCache::get_instance().has_unsaved_changes()) {
+        try {
+            CoefficientCache::get_instance().save_file(coefficient_cache_file);
+        }
+        catch (exception &e) {
+            // exception occurs when the directory is read only (nothing is lost except the saved designs)
+            cout << "Exception occurred: " << e.what() << endl;
+        }
+    }
     return 0;
 }
@@ -0,0 +1,36 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef POLYPHASE_HPP
+
+#include "polyphase.hpp"
+
+std::vector<std::vector<double>> split_polyphase(const std::vector<double>& coefficients, int num_branches) {
+    /* Splits FIR coefficients into polyphase branches for the block kernels
+     *
+     * param coefficients: Filter coefficients (b_0 ... b_(N-1))
+     * param num_branches: Number of branches (M)
+     * return: M branches of ceil(N / M) coefficients each, zero padded and in reverse order
+     *     (branch p is b_(p + (L-1)M) ... b_(p + M), b_p)
+     */
+
+    if (num_branches < 1) {
+        throw std::invalid_argument("Number of polyphase branches must be at least 1!");
+    }
+    if (coefficients.empty()) {
+        throw std::invalid_argument("Polyphase filters need at least 1 coefficient!");
+    }
+
+    int num_coefficients = (int) coefficients.size();
+    int branch_length = (num_coefficients + num_branches - 1) / num_branches;
+    std::vector<std::vector<double>> branches(num_branches, std::vector<double>(branch_length, 0.0));
+    for (int k = 0; k < num_coefficients; ++k) {
+        int p = k % num_branches;
+        int q = k / num_branches;
+        branches[p][branch_length - 1 - q] = coefficients[k];
+    }
+    return branches;
+}
+
+#endif
@@ -0,0 +1,19 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef POLYPHASE_HPP
+#define POLYPHASE_HPP
+
+#include <vector>
+#include <stdexcept>
+
+/* Polyphase decomposition of FIR coefficients (used by the decimating and resampling filters)
+ *
+ * Branch p holds every Mth coefficient starting at b_p (h_p[q] = b_(qM + p)), so a filter whose input or output
+ * is only needed at every Mth sample can be run as M short filters at the lower rate.
+ */
+
+std::vector<std::vector<double>> split_polyphase(const std::vector<double>& coefficients, int num_branches);
+
+#endif //POLYPHASE_HPP
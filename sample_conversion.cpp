@@ -0,0 +1,407 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef SAMPLE_CONVERSION_HPP
+
+#include "sample_conversion.hpp"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SAMPLE_CONVERSION_X86_64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define TARGET_AVX2
+#else
+// only the AVX2 kernels are compiled for AVX2 (selected at runtime)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+template <typename Sample>
+static void deinterleave_scalar(
+    const signed short * interleaved, int num_channels, std::size_t first_frame, std::size_t num_frames,
+    Sample * const * channels
+) {
+    /* Portable kernel (also converts the frames left over by the SIMD kernels) */
+
+    const Sample max_value = (Sample) int16_normalisation;
+    for (int j = 0; j < num_channels; ++j) {
+        Sample * channel = channels[j];
+        for (std::size_t i = first_frame; i < num_frames; ++i) {
+            channel[i] = interleaved[i * num_channels + j] / max_value;
+        }
+    }
+}
+
+template <typename Sample>
+static signed short quantise_sample(Sample sample, bool& clipped) {
+    /* Reverses normalisation, rounds (halves away from zero) and clips a sample between +32767 and -32767 */
+
+    Sample rounded = sample * (Sample) int16_normalisation + std::copysign((Sample) 0.5, sample);
+    if (rounded >= (Sample) 32768) {
+        clipped = true;
+        return 32767;
+    }
+    if (rounded <= (Sample) -32768) {
+        clipped = true;
+        return -32767;
+    }
+    // truncating after adding +-0.5 rounds to the nearest integer
+    return (signed short) (int) rounded;
+}
+
+template <typename Sample>
+static bool interleave_scalar(
+    const Sample * const * channels, int num_channels, std::size_t first_frame, std::size_t num_frames,
+    signed short * interleaved
+) {
+    /* Portable kernel (also converts the frames left over by the SIMD kernels) */
+
+    bool clipped = false;
+    for (int j = 0; j < num_channels; ++j) {
+        const Sample * channel = channels[j];
+        for (std::size_t i = first_frame; i < num_frames; ++i) {
+            interleaved[i * num_channels + j] = quantise_sample(channel[i], clipped);
+        }
+    }
+    return clipped;
+}
+
+#ifdef SAMPLE_CONVERSION_X86_64
+
+static inline void store_int32_sse2(__m128i values, double * output) {
+    /* Converts 4 int32s to normalised doubles */
+    const __m128d max_value = _mm_set1_pd(int16_normalisation);
+    _mm_storeu_pd(output, _mm_div_pd(_mm_cvtepi32_pd(values), max_value));
+    _mm_storeu_pd(output + 2, _mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(values, 0x4e)), max_value));
+}
+
+static inline void store_int32_sse2(__m128i values, float * output) {
+    /* Converts 4 int32s to normalised floats */
+    _mm_storeu_ps(output, _mm_div_ps(_mm_cvtepi32_ps(values), _mm_set1_ps((float) int16_normalisation)));
+}
+
+static inline __m128d quantise_sse2(__m128d samples, __m128i& clipped) {
+    /* Scales, rounds (halves away from zero) and clamps 2 doubles (clipping is recorded in clipped) */
+
+    const __m128d sign_bit = _mm_set1_pd(-0.0);
+    __m128d half = _mm_or_pd(_mm_and_pd(samples, sign_bit), _mm_set1_pd(0.5));
+    __m128d rounded = _mm_add_pd(_mm_mul_pd(samples, _mm_set1_pd(int16_normalisation)), half);
+    __m128d out_of_range = _mm_or_pd(
+        _mm_cmpge_pd(rounded, _mm_set1_pd(32768.0)), _mm_cmple_pd(rounded, _mm_set1_pd(-32768.0))
+    );
+    clipped = _mm_or_si128(clipped, _mm_castpd_si128(out_of_range));
+    return _mm_min_pd(_mm_max_pd(rounded, _mm_set1_pd(-32767.0)), _mm_set1_pd(32767.0));
+}
+
+static inline __m128i load_int32_sse2(const double * input, __m128i& clipped) {
+    /* Quantises 4 doubles to int32s */
+    __m128i low = _mm_cvttpd_epi32(quantise_sse2(_mm_loadu_pd(input), clipped));
+    __m128i high = _mm_cvttpd_epi32(quantise_sse2(_mm_loadu_pd(input + 2), clipped));
+    return _mm_unpacklo_epi64(low, high);
+}
+
+static inline __m128i load_int32_sse2(const float * input, __m128i& clipped) {
+    /* Quantises 4 floats to int32s */
+
+    __m128 samples = _mm_loadu_ps(input);
+    __m128 half = _mm_or_ps(_mm_and_ps(samples, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+    __m128 rounded = _mm_add_ps(_mm_mul_ps(samples, _mm_set1_ps((float) int16_normalisation)), half);
+    __m128 out_of_range = _mm_or_ps(
+        _mm_cmpge_ps(rounded, _mm_set1_ps(32768.0f)), _mm_cmple_ps(rounded, _mm_set1_ps(-32768.0f))
+    );
+    clipped = _mm_or_si128(clipped, _mm_castps_si128(out_of_range));
+    rounded = _mm_min_ps(_mm_max_ps(rounded, _mm_set1_ps(-32767.0f)), _mm_set1_ps(32767.0f));
+    return _mm_cvttps_epi32(rounded);
+}
+
+template <typename Sample>
+static void deinterleave_sse2(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, Sample * const * channels
+) {
+    /* SSE2 kernel for mono and stereo (other channel counts use the scalar kernel) */
+
+    std::size_t i = 0;
+    if (num_channels == 1) {
+        for (; i + 8 <= num_frames; i += 8) {
+            __m128i samples = _mm_loadu_si128((const __m128i *) (interleaved + i));
+            // sign extends each 16 bit sample to 32 bits
+            store_int32_sse2(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16), channels[0] + i);
+            store_int32_sse2(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16), channels[0] + i + 4);
+        }
+    }
+    else if (num_channels == 2) {
+        for (; i + 4 <= num_frames; i += 4) {
+            // each 32 bit lane holds one frame (left in the low half, right in the high half)
+            __m128i frames = _mm_loadu_si128((const __m128i *) (interleaved + 2 * i));
+            store_int32_sse2(_mm_srai_epi32(_mm_slli_epi32(frames, 16), 16), channels[0] + i);
+            store_int32_sse2(_mm_srai_epi32(frames, 16), channels[1] + i);
+        }
+    }
+    deinterleave_scalar(interleaved, num_channels, i, num_frames, channels);
+}
+
+template <typename Sample>
+static bool interleave_sse2(
+    const Sample * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+) {
+    /* SSE2 kernel for mono and stereo (other channel counts use the scalar kernel) */
+
+    __m128i clipped = _mm_setzero_si128();
+    std::size_t i = 0;
+    if (num_channels == 1) {
+        for (; i + 8 <= num_frames; i += 8) {
+            __m128i low = load_int32_sse2(channels[0] + i, clipped);
+            __m128i high = load_int32_sse2(channels[0] + i + 4, clipped);
+            // samples are already within +-32767 so the saturating pack is exact
+            _mm_storeu_si128((__m128i *) (interleaved + i), _mm_packs_epi32(low, high));
+        }
+    }
+    else if (num_channels == 2) {
+        for (; i + 4 <= num_frames; i += 4) {
+            __m128i left = load_int32_sse2(channels[0] + i, clipped);
+            __m128i right = load_int32_sse2(channels[1] + i, clipped);
+            __m128i frames = _mm_packs_epi32(_mm_unpacklo_epi32(left, right), _mm_unpackhi_epi32(left, right));
+            _mm_storeu_si128((__m128i *) (interleaved + 2 * i), frames);
+        }
+    }
+    bool tail_clipped = interleave_scalar(channels, num_channels, i, num_frames, interleaved);
+    return tail_clipped || _mm_movemask_epi8(clipped) != 0;
+}
+
+TARGET_AVX2 static inline void store_int32_avx2(__m256i values, double * output) {
+    /* Converts 8 int32s to normalised doubles */
+    const __m256d max_value = _mm256_set1_pd(int16_normalisation);
+    _mm256_storeu_pd(output, _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(values)), max_value));
+    _mm256_storeu_pd(output + 4, _mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(values, 1)), max_value));
+}
+
+TARGET_AVX2 static inline void store_int32_avx2(__m256i values, float * output) {
+    /* Converts 8 int32s to normalised floats */
+    _mm256_storeu_ps(output, _mm256_div_ps(_mm256_cvtepi32_ps(values), _mm256_set1_ps((float) int16_normalisation)));
+}
+
+TARGET_AVX2 static inline __m256i load_int32_avx2(const double * input, __m256i& clipped) {
+    /* Scales, rounds (halves away from zero), clamps and converts 8 doubles to int32s */
+
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    __m128i halves[2];
+    for (int k = 0; k < 2; ++k) {
+        __m256d samples = _mm256_loadu_pd(input + 4 * k);
+        __m256d half = _mm256_or_pd(_mm256_and_pd(samples, sign_bit), _mm256_set1_pd(0.5));
+        __m256d rounded = _mm256_add_pd(_mm256_mul_pd(samples, _mm256_set1_pd(int16_normalisation)), half);
+        __m256d out_of_range = _mm256_or_pd(
+            _mm256_cmp_pd(rounded, _mm256_set1_pd(32768.0), _CMP_GE_OQ),
+            _mm256_cmp_pd(rounded, _mm256_set1_pd(-32768.0), _CMP_LE_OQ)
+        );
+        clipped = _mm256_or_si256(clipped, _mm256_castpd_si256(out_of_range));
+        rounded = _mm256_min_pd(_mm256_max_pd(rounded, _mm256_set1_pd(-32767.0)), _mm256_set1_pd(32767.0));
+        halves[k] = _mm256_cvttpd_epi32(rounded);
+    }
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(halves[0]), halves[1], 1);
+}
+
+TARGET_AVX2 static inline __m256i load_int32_avx2(const float * input, __m256i& clipped) {
+    /* Scales, rounds (halves away from zero), clamps and converts 8 floats to int32s */
+
+    __m256 samples = _mm256_loadu_ps(input);
+    __m256 half = _mm256_or_ps(_mm256_and_ps(samples, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(0.5f));
+    __m256 rounded = _mm256_add_ps(_mm256_mul_ps(samples, _mm256_set1_ps((float) int16_normalisation)), half);
+    __m256 out_of_range = _mm256_or_ps(
+        _mm256_cmp_ps(rounded, _mm256_set1_ps(32768.0f), _CMP_GE_OQ),
+        _mm256_cmp_ps(rounded, _mm256_set1_ps(-32768.0f), _CMP_LE_OQ)
+    );
+    clipped = _mm256_or_si256(clipped, _mm256_castps_si256(out_of_range));
+    rounded = _mm256_min_ps(_mm256_max_ps(rounded, _mm256_set1_ps(-32767.0f)), _mm256_set1_ps(32767.0f));
+    return _mm256_cvttps_epi32(rounded);
+}
+
+template <typename Sample>
+TARGET_AVX2 static void deinterleave_avx2(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, Sample * const * channels
+) {
+    /* AVX2 kernel for mono and stereo (other channel counts use the scalar kernel) */
+
+    std::size_t i = 0;
+    if (num_channels == 1) {
+        for (; i + 8 <= num_frames; i += 8) {
+            __m128i samples = _mm_loadu_si128((const __m128i *) (interleaved + i));
+            store_int32_avx2(_mm256_cvtepi16_epi32(samples), channels[0] + i);
+        }
+    }
+    else if (num_channels == 2) {
+        for (; i + 8 <= num_frames; i += 8) {
+            // each 32 bit lane holds one frame (left in the low half, right in the high half)
+            __m256i frames = _mm256_loadu_si256((const __m256i *) (interleaved + 2 * i));
+            store_int32_avx2(_mm256_srai_epi32(_mm256_slli_epi32(frames, 16), 16), channels[0] + i);
+            store_int32_avx2(_mm256_srai_epi32(frames, 16), channels[1] + i);
+        }
+    }
+    deinterleave_scalar(interleaved, num_channels, i, num_frames, channels);
+}
+
+template <typename Sample>
+TARGET_AVX2 static bool interleave_avx2(
+    const Sample * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+) {
+    /* AVX2 kernel for mono and stereo (other channel counts use the scalar kernel) */
+
+    __m256i clipped = _mm256_setzero_si256();
+    std::size_t i = 0;
+    if (num_channels == 1) {
+        for (; i + 16 <= num_frames; i += 16) {
+            __m256i low = load_int32_avx2(channels[0] + i, clipped);
+            __m256i high = load_int32_avx2(channels[0] + i + 8, clipped);
+            // the pack works within 128 bit lanes, so the middle 64 bit blocks are swapped back into order
+            __m256i samples = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xd8);
+            _mm256_storeu_si256((__m256i *) (interleaved + i), samples);
+        }
+    }
+    else if (num_channels == 2) {
+        for (; i + 8 <= num_frames; i += 8) {
+            __m256i left = load_int32_avx2(channels[0] + i, clipped);
+            __m256i right = load_int32_avx2(channels[1] + i, clipped);
+            // frames 0-3 end up in the low lane and frames 4-7 in the high lane
+            __m256i frames = _mm256_packs_epi32(
+                _mm256_unpacklo_epi32(left, right), _mm256_unpackhi_epi32(left, right)
+            );
+            _mm256_storeu_si256((__m256i *) (interleaved + 2 * i), frames);
+        }
+    }
+    bool tail_clipped = interleave_scalar(channels, num_channels, i, num_frames, interleaved);
+    return tail_clipped || _mm256_movemask_epi8(clipped) != 0;
+}
+
+#endif
+
+static SimdLevel get_conversion_level(SimdLevel simd_level) {
+    /* Caps an instruction set at the newest one supported by the CPU (AVX-512 uses the AVX2 kernels) */
+
+    // the CPU is only checked once
+    static const SimdLevel supported_level = detect_simd_level();
+    if (simd_level > supported_level) simd_level = supported_level;
+    return (simd_level == avx512_simd) ? avx2_simd : simd_level;
+}
+
+template <typename Sample>
+static void deinterleave(
+    const signed short * interleaved,
+    int num_channels,
+    std::size_t num_frames,
+    Sample * const * channels,
+    SimdLevel simd_level
+) {
+    /* Runs the deinterleaving kernel for an instruction set */
+
+    simd_level = get_conversion_level(simd_level);
+#ifdef SAMPLE_CONVERSION_X86_64
+    if (simd_level == avx2_simd) return deinterleave_avx2(interleaved, num_channels, num_frames, channels);
+    if (simd_level == sse2_simd) return deinterleave_sse2(interleaved, num_channels, num_frames, channels);
+#endif
+    deinterleave_scalar(interleaved, num_channels, 0, num_frames, channels);
+}
+
+template <typename Sample>
+static bool interleave(
+    const Sample * const * channels,
+    int num_channels,
+    std::size_t num_frames,
+    signed short * interleaved,
+    SimdLevel simd_level
+) {
+    /* Runs the interleaving kernel for an instruction set */
+
+    simd_level = get_conversion_level(simd_level);
+#ifdef SAMPLE_CONVERSION_X86_64
+    if (simd_level == avx2_simd) return interleave_avx2(channels, num_channels, num_frames, interleaved);
+    if (simd_level == sse2_simd) return interleave_sse2(channels, num_channels, num_frames, interleaved);
+#endif
+    return interleave_scalar(channels, num_channels, 0, num_frames, interleaved);
+}
+
+void deinterleave_int16_to_double(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, double * const * channels
+) {
+    /* Splits interleaved 16 bit frames into normalised double channels (same scaling as convert_data_to_double)
+     *
+     * param interleaved: Pointer to num_frames * num_channels samples
+     * param num_channels: Number of channels in each frame
+     * param num_frames: Number of frames to convert
+     * param channels: Pointers to num_channels buffers that each receive num_frames samples
+     */
+    deinterleave(interleaved, num_channels, num_frames, channels, avx512_simd);
+}
+
+void deinterleave_int16_to_double(
+    const signed short * interleaved,
+    int num_channels,
+    std::size_t num_frames,
+    double * const * channels,
+    SimdLevel simd_level
+) {
+    /* Same as above using a specific instruction set (used for benchmarking) */
+    deinterleave(interleaved, num_channels, num_frames, channels, simd_level);
+}
+
+void deinterleave_int16_to_float(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, float * const * channels
+) {
+    /* Splits interleaved 16 bit frames into normalised float channels */
+    deinterleave(interleaved, num_channels, num_frames, channels, avx512_simd);
+}
+
+bool interleave_double_to_int16(
+    const double * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+) {
+    /* Builds interleaved 16 bit frames from normalised double channels (same as convert_data_to_short)
+     *
+     * param channels: Pointers to num_channels arrays of num_frames samples
+     * param num_channels: Number of channels in each frame
+     * param num_frames: Number of frames to convert
+     * param interleaved: Pointer to a buffer that receives num_frames * num_channels samples
+     * return: true if any sample was clipped
+     */
+    return interleave(channels, num_channels, num_frames, interleaved, avx512_simd);
+}
+
+bool interleave_double_to_int16(
+    const double * const * channels,
+    int num_channels,
+    std::size_t num_frames,
+    signed short * interleaved,
+    SimdLevel simd_level
+) {
+    /* Same as above using a specific instruction set (used for benchmarking) */
+    return interleave(channels, num_channels, num_frames, interleaved, simd_level);
+}
+
+bool interleave_float_to_int16(
+    const float * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+) {
+    /* Builds interleaved 16 bit frames from normalised float channels */
+    return interleave(channels, num_channels, num_frames, interleaved, avx512_simd);
+}
+
+void int16_to_double(const signed short * input, double * output, std::size_t length) {
+    /* Converts one channel of 16 bit samples to normalised doubles */
+    deinterleave(input, 1, length, &output, avx512_simd);
+}
+
+void int16_to_float(const signed short * input, float * output, std::size_t length) {
+    /* Converts one channel of 16 bit samples to normalised floats */
+    deinterleave(input, 1, length, &output, avx512_simd);
+}
+
+bool double_to_int16(const double * input, signed short * output, std::size_t length) {
+    /* Converts one channel of normalised doubles to 16 bit samples (returns true if any were clipped) */
+    return interleave(&input, 1, length, output, avx512_simd);
+}
+
+bool float_to_int16(const float * input, signed short * output, std::size_t length) {
+    /* Converts one channel of normalised floats to 16 bit samples (returns true if any were clipped) */
+    return interleave(&input, 1, length, output, avx512_simd);
+}
+
+#endif
@@ -0,0 +1,58 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef SAMPLE_CONVERSION_HPP
+#define SAMPLE_CONVERSION_HPP
+
+#include <cstddef>
+
+#ifndef FIR_KERNELS_HPP
+#include "fir_kernels.hpp"
+#endif
+
+// 16 bit samples are normalised between 1 and -1 by dividing by this value
+const double int16_normalisation = 32767.0;
+
+/* Conversions between 16 bit PCM samples and normalised floating point samples
+ *
+ * Interleaved frames (as stored in WAV files) are split into (or built from) one array per channel in the same
+ * pass as the conversion. Conversions to int16 round to the nearest integer (halves away from zero) and clip to
+ * +-32767, returning true if any sample was clipped.
+ */
+
+void deinterleave_int16_to_double(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, double * const * channels
+);
+void deinterleave_int16_to_double(
+    const signed short * interleaved,
+    int num_channels,
+    std::size_t num_frames,
+    double * const * channels,
+    SimdLevel simd_level
+);
+void deinterleave_int16_to_float(
+    const signed short * interleaved, int num_channels, std::size_t num_frames, float * const * channels
+);
+
+bool interleave_double_to_int16(
+    const double * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+);
+bool interleave_double_to_int16(
+    const double * const * channels,
+    int num_channels,
+    std::size_t num_frames,
+    signed short * interleaved,
+    SimdLevel simd_level
+);
+bool interleave_float_to_int16(
+    const float * const * channels, int num_channels, std::size_t num_frames, signed short * interleaved
+);
+
+// single channel conversions (no interleaving)
+void int16_to_double(const signed short * input, double * output, std::size_t length);
+void int16_to_float(const signed short * input, float * output, std::size_t length);
+bool double_to_int16(const double * input, signed short * output, std::size_t length);
+bool float_to_int16(const float * input, signed short * output, std::size_t length);
+
+#endif //SAMPLE_CONVERSION_HPP
@@ -0,0 +1,215 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef SIGNAL_FILE_HPP
+
+#include "signal_file.hpp"
+
+static_assert(sizeof(SignalFileHeader) == 64, "The signal file header must be 64 bytes");
+
+// number of samples converted between float32 and float64 at a time
+static const std::size_t conversion_block_size = 1 << 16;
+
+std::size_t get_sample_size(SampleType sample_type) {
+    /*
+     * param sample_type: float32_samples or float64_samples
+     * return: Size of one sample (in bytes)
+     */
+
+    if (sample_type == float32_samples) return sizeof(float);
+    if (sample_type == float64_samples) return sizeof(double);
+    throw std::invalid_argument("Unknown sample type!");
+}
+
+template <typename Stored, typename Sample>
+static bool write_samples(FILE * fp, const std::vector<Sample>& channel, std::vector<Stored>& block) {
+    /* Writes a channel as the stored sample type (converted a block at a time unless the types match)
+     *
+     * return: True if the write failed
+     */
+
+    if (std::is_same<Stored, Sample>::value) {
+        // samples are written straight from the channel
+        return fwrite(channel.data(), sizeof(Sample), channel.size(), fp) != channel.size();
+    }
+    for (std::size_t first = 0; first < channel.size(); first += conversion_block_size) {
+        std::size_t block_length = std::min(conversion_block_size, channel.size() - first);
+        block.assign(channel.begin() + (std::ptrdiff_t) first, channel.begin() + (std::ptrdiff_t) (first + block_length));
+        if (fwrite(block.data(), sizeof(Stored), block_length, fp) != block_length) return true;
+    }
+    return false;
+}
+
+template <typename Stored, typename Sample>
+static bool read_samples(FILE * fp, std::vector<Sample>& channel, std::vector<Stored>& block) {
+    /* Reads a channel that is stored as another sample type (converted a block at a time unless the types match)
+     *
+     * return: True if the read failed (the file is too short)
+     */
+
+    if (std::is_same<Stored, Sample>::value) {
+        // samples are read straight into the channel
+        return fread(channel.data(), sizeof(Sample), channel.size(), fp) != channel.size();
+    }
+    for (std::size_t first = 0; first < channel.size(); first += conversion_block_size) {
+        std::size_t block_length = std::min(conversion_block_size, channel.size() - first);
+        block.resize(block_length);
+        if (fread(block.data(), sizeof(Stored), block_length, fp) != block_length) return true;
+        std::copy(block.begin(), block.end(), channel.begin() + (std::ptrdiff_t) first);
+    }
+    return false;
+}
+
+template <typename Sample>
+void write_signal(
+    const std::string& file_name,
+    const std::vector<std::vector<Sample>>& channels,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+) {
+    /* Writes channels to a binary signal file (no time column is stored, only the sample rate and start time)
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param channels: Signal to write (all channels must be the same length)
+     * param sample_rate: Sample rate of the signal (in Hz)
+     * param sample_type: Type the samples are stored as (float32_samples halves the file size)
+     * param start_time: Time of the first sample (in seconds)
+     */
+
+    std::size_t num_frames = channels.empty() ? 0 : channels[0].size();
+    for (const std::vector<Sample>& channel : channels) {
+        if (channel.size() != num_frames) {
+            throw std::invalid_argument("Every channel of a signal file must have the same length!");
+        }
+    }
+
+    SignalFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, signal_file_magic, sizeof(header.magic));
+    header.version = signal_file_version;
+    header.sample_type = sample_type;
+    header.num_channels = (std::uint32_t) channels.size();
+    header.header_size = sizeof(SignalFileHeader);
+    header.num_frames = num_frames;
+    header.sample_rate = sample_rate;
+    header.start_time = start_time;
+    get_sample_size(sample_type);  // throws for unknown sample types
+
+    FILE * fp = fopen(file_name.c_str(), "wb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    bool write_failed = fwrite(&header, sizeof(header), 1, fp) != 1;
+    std::vector<float> float_block;
+    std::vector<double> double_block;
+    for (const std::vector<Sample>& channel : channels) {
+        if (write_failed) break;
+        write_failed = (sample_type == float64_samples)
+            ? write_samples(fp, channel, double_block)
+            : write_samples(fp, channel, float_block);
+    }
+
+    if (fclose(fp) != 0 || write_failed) {
+        throw std::runtime_error("Unable to write file " + file_name + "!");
+    }
+}
+
+SignalFileHeader read_signal_header(FILE * fp, const std::string& file_name) {
+    /* Reads and checks the header of a binary signal file
+     *
+     * param fp: File positioned at the start of the header (left positioned at the first sample)
+     * param file_name: Name of the file (used for errors)
+     * return: The header
+     */
+
+    SignalFileHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 || memcmp(header.magic, signal_file_magic, 8) != 0) {
+        throw std::runtime_error("File " + file_name + " is not a signal file!");
+    }
+    if (header.version != signal_file_version || header.header_size < sizeof(SignalFileHeader)) {
+        throw std::runtime_error("Signal file " + file_name + " uses an unsupported version!");
+    }
+    get_sample_size((SampleType) header.sample_type);  // throws for unknown sample types
+    if (fseek(fp, (long) header.header_size, SEEK_SET) != 0) {
+        throw std::runtime_error("Signal file " + file_name + " is too short!");
+    }
+    return header;
+}
+
+template <typename Sample>
+std::vector<std::vector<Sample>> read_signal(const std::string& file_name, SignalFileHeader& header) {
+    /* Reads a binary signal file (samples stored as another type are converted to Sample)
+     *
+     * param file_name: Name of the file (no suffix is added)
+     * param header: Receives the header of the file (sample rate, start time etc.)
+     * return: Signal (one vector per channel)
+     */
+
+    FILE * fp = fopen(file_name.c_str(), "rb");
+    if (fp == nullptr) {
+        throw std::runtime_error("Unable to open file " + file_name + "!");
+    }
+
+    std::vector<std::vector<Sample>> channels;
+    try {
+        header = read_signal_header(fp, file_name);
+        auto num_frames = (std::size_t) header.num_frames;
+
+        // the sizes in the header are checked against the file before anything is allocated
+        long payload_start = ftell(fp);
+        if (payload_start < 0 || fseek(fp, 0, SEEK_END) != 0) {
+            throw std::runtime_error("Unable to read file " + file_name + "!");
+        }
+        long file_size = ftell(fp);
+        if (file_size < payload_start || fseek(fp, payload_start, SEEK_SET) != 0) {
+            throw std::runtime_error("Signal file " + file_name + " is too short!");
+        }
+        std::size_t payload_size = (std::size_t) (file_size - payload_start);
+        std::size_t sample_size = get_sample_size((SampleType) header.sample_type);
+        // divided rather than multiplied so corrupt sizes cannot overflow
+        if (header.num_channels > 0 && num_frames > payload_size / sample_size / header.num_channels) {
+            throw std::runtime_error("Signal file " + file_name + " is too short!");
+        }
+        channels.resize(header.num_channels);
+
+        std::vector<float> float_block;
+        std::vector<double> double_block;
+        for (std::vector<Sample>& channel : channels) {
+            channel.resize(num_frames);
+            bool read_failed = (header.sample_type == float64_samples)
+                ? read_samples(fp, channel, double_block)
+                : read_samples(fp, channel, float_block);
+            if (read_failed) {
+                throw std::runtime_error("Signal file " + file_name + " is too short!");
+            }
+        }
+    }
+    catch (...) {
+        fclose(fp);
+        throw;
+    }
+    fclose(fp);
+    return channels;
+}
+
+template void write_signal(
+    const std::string& file_name,
+    const std::vector<std::vector<double>>& channels,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+);
+template void write_signal(
+    const std::string& file_name,
+    const std::vector<std::vector<float>>& channels,
+    double sample_rate,
+    SampleType sample_type,
+    double start_time
+);
+template std::vector<std::vector<double>> read_signal(const std::string& file_name, SignalFileHeader& header);
+template std::vector<std::vector<float>> read_signal(const std::string& file_name, SignalFileHeader& header);
+
+#endif
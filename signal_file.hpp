@@ -0,0 +1,57 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef SIGNAL_FILE_HPP
+#define SIGNAL_FILE_HPP
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+
+/* Binary signal file layout (little endian):
+ *
+ * 64 byte header (SignalFileHeader), followed by the samples of channel 0, then channel 1 etc. (planar).
+ * The payload starts 64 bytes in, so every channel of a memory mapped file is suitably aligned.
+ */
+
+/* Types that samples can be stored as */
+enum SampleType { float32_samples = 1, float64_samples = 2 };
+
+const char signal_file_magic[8] = {'D', 'F', 'S', 'I', 'G', 'N', 'A', 'L'};
+const std::uint32_t signal_file_version = 1;
+
+typedef struct signal_file_header {
+    char magic[8];  // contains "DFSIGNAL"
+    std::uint32_t version;  // format version (1)
+    std::uint32_t sample_type;  // float32_samples or float64_samples
+    std::uint32_t num_channels;
+    std::uint32_t header_size;  // bytes before the first sample (64)
+    std::uint64_t num_frames;  // number of samples in each channel
+    double sample_rate;  // in Hz
+    double start_time;  // time of the first sample (in seconds)
+    unsigned char reserved[16];  // zeros (room for future fields)
+} SignalFileHeader;
+
+std::size_t get_sample_size(SampleType sample_type);
+
+// channels can be held as float or double whichever type the samples are stored as (they are converted in blocks)
+template <typename Sample>
+void write_signal(
+    const std::string& file_name,
+    const std::vector<std::vector<Sample>>& channels,
+    double sample_rate,
+    SampleType sample_type = float64_samples,
+    double start_time = 0.0
+);
+SignalFileHeader read_signal_header(FILE * fp, const std::string& file_name);
+template <typename Sample = double>
+std::vector<std::vector<Sample>> read_signal(const std::string& file_name, SignalFileHeader& header);
+
+#endif //SIGNAL_FILE_HPP
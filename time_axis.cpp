@@ -0,0 +1,51 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef TIME_AXIS_HPP
+
+#include "time_axis.hpp"
+
+TimeAxis make_time_axis(double sample_rate, double start) {
+    /* Describes the times of a sampled signal
+     *
+     * param sample_rate: Samples per second (must be positive)
+     * param start: Time of the first sample (in seconds)
+     * return: Time axis of the signal
+     */
+
+    if (!(sample_rate > 0.0)) {
+        throw std::invalid_argument("Sample rate of a time axis must be positive!");
+    }
+    TimeAxis time_axis;
+    time_axis.start = start;
+    time_axis.sample_rate = sample_rate;
+    return time_axis;
+}
+
+TimeAxis make_index_axis() {
+    /* Describes an axis that counts 0, 1, 2 ... (e.g. filter coefficient numbers)
+     *
+     * return: Time axis with one sample per unit
+     */
+
+    return make_time_axis(1.0);
+}
+
+double get_time(const TimeAxis& time_axis, std::size_t index) {
+    /*
+     * param time_axis: Time axis of the signal
+     * param index: Sample number
+     * return: Time of the sample
+     */
+    return time_axis.start + (double) index / time_axis.sample_rate;
+}
+
+double get_time_step(const TimeAxis& time_axis) {
+    /*
+     * return: Time between neighbouring samples (1 / sample rate)
+     */
+    return 1.0 / time_axis.sample_rate;
+}
+
+#endif
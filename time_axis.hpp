@@ -0,0 +1,27 @@
+//
+// Created by Abdul on 17/10/2026.
+//
+
+#ifndef TIME_AXIS_HPP
+#define TIME_AXIS_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+/* Evenly spaced sample times, calculated when they are needed instead of being stored
+ *
+ * Sample i is at start + i / sample_rate (a step of 1 / sample_rate). Dividing by the sample rate gives exactly
+ * the same times as the x-axis vectors that were stored before.
+ */
+typedef struct time_axis {
+    double start;  // time of the first sample (seconds)
+    double sample_rate;  // samples per second
+} TimeAxis;
+
+TimeAxis make_time_axis(double sample_rate, double start = 0.0);
+TimeAxis make_index_axis();
+
+double get_time(const TimeAxis& time_axis, std::size_t index);
+double get_time_step(const TimeAxis& time_axis);
+
+#endif //TIME_AXIS_HPP
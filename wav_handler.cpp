@@ -20,15 +20,13 @@ bool is_WAV(const char * actual_value, const char * expected_value) {
 vector<vector<double>> convert_data_to_double(const vector<vector<signed short>> & data) {
     /* Converts 2D int vector into 2D double vector */
 
-    double max_value = 32767;
     vector<vector<double>> double_data;
+    double_data.reserve(data.size());
     for (const vector<signed short> & channel : data) {
-        vector<double> double_channel;
-        for (signed short sample : channel) {
-            // normalises the signal between 1 and -1
-            double_channel.push_back(sample / max_value);
-        }
-        double_data.push_back(double_channel);
+        // normalises the signal between 1 and -1 (SIMD kernel)
+        vector<double> double_channel(channel.size());
+        int16_to_double(channel.data(), double_channel.data(), channel.size());
+        double_data.push_back(std::move(double_channel));
     }
     return double_data;
 }
@@ -36,29 +34,29 @@ vector<vector<double>> convert_data_to_double(const vector<vector<signed short>>
 vector<vector<signed short>> convert_data_to_short(const vector<vector<double>> & data) {
     /* Converts 2D double vector into 2D int vector */
 
-    int max_value = 32767;
-    int min_value = -32767;
     bool clipped = false;
     vector<vector<signed short>> short_data;
+    short_data.reserve(data.size());
     for (const vector<double> & channel : data) {
-        vector<signed short> short_channel;
-        for (double sample : channel) {
-            // reverses normalisation and rounds double values into integers
-            int unclipped_sample = lround(sample * max_value);
-            // clips sample values between +32767 and -32768
-            if (unclipped_sample > max_value) {
-                unclipped_sample = max_value;
-                clipped = true;
-            }
-            else if (unclipped_sample < min_value) {
-                unclipped_sample = min_value;
-                clipped = true;
-            }
-            // clipped int is cast to signed short datatype
-            auto short_sample = (signed short) unclipped_sample;
-            short_channel.push_back(short_sample);
-        }
-        short_data.push_back(short_channel);
+        // reverses normalisation, rounds and clips sample values between +32767 and -32767 (SIMD kernel)
+        vector<signed short> short_channel(channel.size());
+        if (double_to_int16(channel.data(), short_channel.data(), channel.size())) clipped = true;
+        short_data.push_back(std::move(short_channel));
+    }
+    if (clipped) cout << "Warning: Some data was clipped while writing the file" << endl;
+    return short_data;
+}
+
+vector<vector<signed short>> convert_data_to_short(const vector<vector<float>> & data) {
+    /* Converts 2D float vector into 2D int vector (rounded and clipped the same way as doubles) */
+
+    bool clipped = false;
+    vector<vector<signed short>> short_data;
+    short_data.reserve(data.size());
+    for (const vector<float> & channel : data) {
+        vector<signed short> short_channel(channel.size());
+        if (float_to_int16(channel.data(), short_channel.data(), channel.size())) clipped = true;
+        short_data.push_back(std::move(short_channel));
     }
     if (clipped) cout << "Warning: Some data was clipped while writing the file" << endl;
     return short_data;
@@ -187,19 +185,49 @@ WavFile read_wav(const string& file_name) {
     fread(&wav_file.data_chunk_size, sizeof(unsigned int), 1, fp);
     cout << "WAV file data_chunk_size: " << wav_file.data_chunk_size << endl;
 
-    // reads data and puts it into a vector
+    if (wav_file.num_channels == 0) {
+        fclose(fp);
+        throw runtime_error("Error: WAV file " + full_file_name + " has no channels!");
+    }
+
+    // the data chunk is read in large blocks of interleaved frames, which are then split by channel
+    size_t num_frames = wav_file.data_chunk_size / sizeof(signed short) / wav_file.num_channels;
     vector<vector<signed short>> data_vector;
     data_vector.resize(wav_file.num_channels);  // splits into 2D vector based on number of channels
-    for (int _ = 0; _ < (wav_file.data_chunk_size) / sizeof(signed short) / wav_file.num_channels; ++_) {
-        signed short temp;
+    for (vector<signed short> & channel : data_vector) {
+        channel.resize(num_frames);
+    }
+
+    const size_t block_frames = 1 << 16;
+    vector<signed short> block(min(block_frames, num_frames) * wav_file.num_channels);
+    size_t frames_read = 0;
+    while (frames_read < num_frames) {
+        size_t frames_wanted = min(block_frames, num_frames - frames_read);
+        // 16 bit samples are saved as 2's complement signed integers (each channel is a short)
+        size_t samples_read = fread(block.data(), sizeof(signed short), frames_wanted * wav_file.num_channels, fp);
+        size_t frames_in_block = samples_read / wav_file.num_channels;
+
         // separates data samples by channel
         for (int j = 0; j < wav_file.num_channels; ++j) {
-            // 16 bit samples are saved as 2's complement signed integers (each channel is a short)
-            fread(&temp, sizeof(signed short), 1, fp);
-            data_vector[j].push_back(temp);
+            signed short * channel = data_vector[j].data() + frames_read;
+            const signed short * interleaved = block.data() + j;
+            for (size_t i = 0; i < frames_in_block; ++i) {
+                channel[i] = interleaved[i * wav_file.num_channels];
+            }
+        }
+        frames_read += frames_in_block;
+
+        if (frames_in_block < frames_wanted) {
+            cerr << "Warning: WAV file ended early (" << frames_read << " of " << num_frames
+                 << " frames were read)" << endl;
+            for (vector<signed short> & channel : data_vector) {
+                channel.resize(frames_read);
+            }
+            wav_file.data_chunk_size = (unsigned int) (frames_read * wav_file.num_channels * sizeof(signed short));
+            break;
         }
     }
-    wav_file.data = data_vector;
+    wav_file.data = std::move(data_vector);
 
     // closes file reader
     fclose(fp);
@@ -207,8 +235,20 @@ WavFile read_wav(const string& file_name) {
     return wav_file;
 }
 
-void write_wav(WavFile wav_file, const std::string& file_name) {
-    /* Writes a WAV file using data stored in a WavFile object (+ inputted file name) */
+static void append_bytes(vector<unsigned char> & buffer, const void * value, size_t num_bytes) {
+    /* Appends the bytes of a header field to a buffer */
+
+    const auto * bytes = (const unsigned char *) value;
+    buffer.insert(buffer.end(), bytes, bytes + num_bytes);
+}
+
+void write_wav(const WavFile & wav_file, const std::string& file_name, bool verbose) {
+    /* Writes a WAV file using data stored in a WavFile object (+ inputted file name)
+     *
+     * param wav_file: WAV file to write (JUNK chunks are not written)
+     * param file_name: Name of the file to write (.wav is added if missing)
+     * param verbose: Prints each header field if true
+     */
 
     // adds .wav suffix if it doesn't already exist
     string full_file_name = file_name;
@@ -216,105 +256,94 @@ void write_wav(WavFile wav_file, const std::string& file_name) {
         full_file_name = file_name + ".wav";
     }
 
-    // prepares reader
+    // prepares writer
     FILE * fp = fopen(full_file_name.c_str(), "wb");
-    // checks if file was read successfully
+    // checks if file was opened successfully
     if (fp == nullptr) {
-        cerr << "Error: Failed to read file!" << endl;
-        exit(EXIT_FAILURE);
+        throw runtime_error("Error: Failed to write file " + full_file_name + "!");
     }
     cout << endl << "Writing WAV file " << full_file_name << "..." << endl;
 
-    // writes the chunk_id ("RIFF")
-    fwrite(wav_file.chunk_id, sizeof(unsigned char), 4, fp);
-    cout << "WAV file chunk_id: " << wav_file.chunk_id << endl;
-
-    // writes the chunk_size
-    fwrite(&wav_file.chunk_size, sizeof(unsigned int), 1, fp);
-    cout << "WAV file chunk_size: " << wav_file.chunk_size << endl;
-
-    // writes the file_format ("WAVE")
-    fwrite(wav_file.file_format, sizeof(unsigned char), 4, fp);
-    cout << "WAV file format: " << wav_file.file_format << endl;
-
-    // writes the fmt_chunk_id ("fmt ")
-    fwrite(wav_file.fmt_chunk_id, sizeof(unsigned char), 4, fp);
-    cout << "WAV file fmt_chunk_id: " << wav_file.fmt_chunk_id << endl;
-
-    // writes the fmt_chunk_size
-    fwrite(&wav_file.fmt_chunk_size, sizeof(unsigned int), 1, fp);
-    cout << "WAV file fmt_chunk_size: " << wav_file.fmt_chunk_size << endl;
-
-    // writes the audio_format
-    fwrite(&wav_file.audio_format, sizeof(unsigned short), 1, fp);
-    cout << "WAV file audio_format: " << wav_file.audio_format << endl;
-
-    // writes the num_channels
-    fwrite(&wav_file.num_channels, sizeof(unsigned short), 1, fp);
-    cout << "WAV file num_channels: " << wav_file.num_channels << endl;
-
-    // writes the sample_rate
-    fwrite(&wav_file.sample_rate, sizeof(unsigned int), 1, fp);
-    cout << "WAV file sample_rate: " << wav_file.sample_rate << endl;
-
-    // writes the byte_rate
-    fwrite(&wav_file.byte_rate, sizeof(unsigned int), 1, fp);
-    cout << "WAV file byte_rate: " << wav_file.byte_rate << endl;
-
-    // writes the block_align
-    fwrite(&wav_file.block_align, sizeof(unsigned short), 1, fp);
-    cout << "WAV file block_align: " << wav_file.block_align << endl;
-
-    // writes the bits_per_sample
-    fwrite(&wav_file.bits_per_sample, sizeof(unsigned short), 1, fp);
-    cout << "WAV file bits_per_sample: " << wav_file.bits_per_sample << endl;
-
-    // writes extra empty bytes if the size of the fmt chunk is larger than expected
-    unsigned char extra_dat = 0;
+    // number of frames actually available in every channel
+    size_t num_frames = wav_file.data_chunk_size / sizeof(signed short) / wav_file.num_channels;
+    for (const vector<signed short> & channel : wav_file.data) {
+        num_frames = min(num_frames, channel.size());
+    }
+    auto data_chunk_size = (unsigned int) (num_frames * wav_file.num_channels * sizeof(signed short));
+    // RIFF chunk = "WAVE" + "fmt " chunk (ID, size and content) + "data" chunk (ID, size and content)
+    unsigned int chunk_size = 4 + (8 + wav_file.fmt_chunk_size) + (8 + data_chunk_size);
+
+    // the whole header is assembled first so it can be written with one call
+    vector<unsigned char> header;
+    header.reserve(44 + wav_file.fmt_chunk_size);
+    append_bytes(header, wav_file.chunk_id, 4);  // "RIFF"
+    append_bytes(header, &chunk_size, sizeof(unsigned int));
+    append_bytes(header, wav_file.file_format, 4);  // "WAVE"
+    append_bytes(header, wav_file.fmt_chunk_id, 4);  // "fmt "
+    append_bytes(header, &wav_file.fmt_chunk_size, sizeof(unsigned int));
+    append_bytes(header, &wav_file.audio_format, sizeof(unsigned short));
+    append_bytes(header, &wav_file.num_channels, sizeof(unsigned short));
+    append_bytes(header, &wav_file.sample_rate, sizeof(unsigned int));
+    append_bytes(header, &wav_file.byte_rate, sizeof(unsigned int));
+    append_bytes(header, &wav_file.block_align, sizeof(unsigned short));
+    append_bytes(header, &wav_file.bits_per_sample, sizeof(unsigned short));
+    // pads with empty bytes if the size of the fmt chunk is larger than expected
     if (wav_file.fmt_chunk_size > 16) {
-        unsigned int extra_dats = wav_file.fmt_chunk_size - 16;
-        for (int _ = 0; _ < extra_dats; ++_) {
-            fwrite(&extra_dat, sizeof(unsigned char), 1, fp);
-        }
+        header.insert(header.end(), wav_file.fmt_chunk_size - 16, 0);
+    }
+    append_bytes(header, wav_file.data_chunk_id, 4);  // "data"
+    append_bytes(header, &data_chunk_size, sizeof(unsigned int));
+
+    if (verbose) {
+        cout << "WAV file chunk_id: " << string((const char *) wav_file.chunk_id, 4) << endl;
+        cout << "WAV file chunk_size: " << chunk_size << endl;
+        cout << "WAV file format: " << string((const char *) wav_file.file_format, 4) << endl;
+        cout << "WAV file fmt_chunk_id: " << string((const char *) wav_file.fmt_chunk_id, 4) << endl;
+        cout << "WAV file fmt_chunk_size: " << wav_file.fmt_chunk_size << endl;
+        cout << "WAV file audio_format: " << wav_file.audio_format << endl;
+        cout << "WAV file num_channels: " << wav_file.num_channels << endl;
+        cout << "WAV file sample_rate: " << wav_file.sample_rate << endl;
+        cout << "WAV file byte_rate: " << wav_file.byte_rate << endl;
+        cout << "WAV file block_align: " << wav_file.block_align << endl;
+        cout << "WAV file bits_per_sample: " << wav_file.bits_per_sample << endl;
+        cout << "WAV file data_chunk_id: " << string((const char *) wav_file.data_chunk_id, 4) << endl;
+        cout << "WAV file data_chunk_size: " << data_chunk_size << endl;
     }
 
-    // writes the data_chunk_id ("data")
-    fwrite(wav_file.data_chunk_id, sizeof(unsigned char), 4, fp);
-    cout << "WAV file data_chunk_id: " << wav_file.data_chunk_id << endl;
-
-    // writes the data_chunk_size
-    fwrite(&wav_file.data_chunk_size, sizeof(unsigned int), 1, fp);
-    cout << "WAV file data_chunk_size: " << wav_file.data_chunk_size << endl;
+    bool write_failed = fwrite(header.data(), 1, header.size(), fp) != header.size();
 
-    // writes the data content
-    int count = 0;
-    for (int i = 0; i < (wav_file.data_chunk_size) / sizeof(signed short) / wav_file.num_channels; ++i) {
-        signed short temp;
+    // channels are interleaved into large blocks, each written with one call
+    // 16 bit samples are saved as 2's complement signed integers
+    const size_t block_frames = 1 << 16;
+    vector<signed short> block(min(block_frames, num_frames) * wav_file.num_channels);
+    for (size_t first_frame = 0; first_frame < num_frames && !write_failed; first_frame += block_frames) {
+        size_t frames_in_block = min(block_frames, num_frames - first_frame);
         for (int j = 0; j < wav_file.num_channels; ++j) {
-            temp = wav_file.data[j][i];
-            // 16 bit samples are saved as 2's complement signed integers
-            fwrite(&temp, sizeof(signed short), 1, fp);
+            const signed short * channel = wav_file.data[j].data() + first_frame;
+            signed short * interleaved = block.data() + j;
+            for (size_t i = 0; i < frames_in_block; ++i) {
+                interleaved[i * wav_file.num_channels] = channel[i];
+            }
         }
-        ++count;
+        size_t num_samples = frames_in_block * wav_file.num_channels;
+        write_failed = fwrite(block.data(), sizeof(signed short), num_samples, fp) != num_samples;
     }
 
     // closes file writer
-    fclose(fp);
+    if (fclose(fp) != 0 || write_failed) {
+        throw runtime_error("Error: Failed to write file " + full_file_name + "!");
+    }
 }
 
-WavFile generate_wav(
-    const vector<vector<double>> & data,
+static WavFile generate_wav_from_short(
+    vector<vector<signed short>> short_data,
     unsigned short num_channels,
     double sample_rate
 ) {
-    /* Generates a WAV file using a vector of data (signal) */
-
-    cout << endl << "Generating WAV file..." << endl;
+    /* Fills in the header of a WAV file for 16 bit data (see generate_wav) */
 
     WavFile wav_file;
-
-    // converts inputted data to correct type (signed short)
-    wav_file.data = convert_data_to_short(data);
+    wav_file.data = std::move(short_data);
 
     // header chunk IDs
     strcpy((char *) wav_file.chunk_id, "RIFF");
@@ -339,7 +368,7 @@ WavFile generate_wav(
     // size of data chunk content = bytes per data * number of data
     wav_file.data_chunk_size = wav_file.num_channels * wav_file.data[0].size() * sizeof(signed short);
     wav_file.fmt_chunk_size = 16;  // 16 for PCM
-    int id_bytes = 3 * 5;  // 20 bytes for IDs excluding "RIFF"
+    int id_bytes = 3 * 4;  // 12 bytes for IDs excluding "RIFF"
 
     // total chunk size = (bytes of IDs) + (bytes of chunk sizes) + (fmt chunk size) + (data chunk size)
     wav_file.chunk_size = id_bytes + (sizeof(unsigned int) * 2) + wav_file.fmt_chunk_size + wav_file.data_chunk_size;
@@ -347,4 +376,30 @@ WavFile generate_wav(
     return wav_file;
 }
 
+WavFile generate_wav(
+    const vector<vector<double>> & data,
+    unsigned short num_channels,
+    double sample_rate
+) {
+    /* Generates a WAV file using a vector of data (signal) */
+
+    cout << endl << "Generating WAV file..." << endl;
+
+    // converts inputted data to correct type (signed short)
+    return generate_wav_from_short(convert_data_to_short(data), num_channels, sample_rate);
+}
+
+WavFile generate_wav(
+    const vector<vector<float>> & data,
+    unsigned short num_channels,
+    double sample_rate
+) {
+    /* Generates a WAV file using a single precision signal */
+
+    cout << endl << "Generating WAV file..." << endl;
+
+    // converts inputted data to correct type (signed short)
+    return generate_wav_from_short(convert_data_to_short(data), num_channels, sample_rate);
+}
+
 #endif
@@ -9,9 +9,14 @@
 #include <iostream>
 #include <fstream>
 #include <cstdio>
+#include <cstring>
 #include <cmath>
 #include <algorithm>
 
+#ifndef SAMPLE_CONVERSION_HPP
+#include "sample_conversion.hpp"
+#endif
+
 typedef struct wav_file {
     unsigned char chunk_id[4];  // contains "RIFF"
     unsigned int chunk_size;  // size of file excluding chunk_id and chunk_size
@@ -33,13 +38,19 @@ typedef struct wav_file {
 
 std::vector<std::vector<double>> convert_data_to_double(const std::vector<std::vector<signed short>> & data);
 std::vector<std::vector<signed short>> convert_data_to_short(const std::vector<std::vector<double>> & data);
+std::vector<std::vector<signed short>> convert_data_to_short(const std::vector<std::vector<float>> & data);
 
 WavFile read_wav(const std::string& file_name);
-void write_wav(WavFile wav_file, const std::string& file_name);
+void write_wav(const WavFile & wav_file, const std::string& file_name, bool verbose = false);
 WavFile generate_wav(
     const std::vector<std::vector<double>> & data,
     unsigned short num_channels,
     double sample_rate
 );
+WavFile generate_wav(
+    const std::vector<std::vector<float>> & data,
+    unsigned short num_channels,
+    double sample_rate
+);
 
 #endif //WAV_HANDLER_HPP